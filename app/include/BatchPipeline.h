@@ -0,0 +1,111 @@
+/** @file BatchPipeline.h
+ * Bounded queue and ordered parse/compute/write pipeline for batch runs.
+ */
+#pragma once
+
+#include "LFMF.h"
+#include "ReturnCodes.h"
+#include "Structs.h"
+
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <deque>               // for std::deque
+#include <functional>          // for std::function
+#include <mutex>               // for std::mutex, std::unique_lock
+#include <utility>             // for std::move
+
+/** One scenario as it moves through the batch pipeline */
+struct BatchScenario {
+        std::size_t index = 0; /**< Position of the scenario in the input   */
+        LFMFParams params{};   /**< Parsed LFMF Model inputs               */
+        DrvrReturnCode parse_rtn = DRVR__SUCCESS; /**< Parsing return code */
+        ITS::Propagation::LFMF::ReturnCode rtn
+            = ITS::Propagation::LFMF::SUCCESS;  /**< Model return code     */
+        ITS::Propagation::LFMF::Result result{}; /**< Model outputs        */
+};
+
+/*******************************************************************************
+ * @class BoundedQueue
+ * A first-in, first-out queue shared between threads, holding at most a fixed
+ * number of items.
+ *
+ * `Push()` blocks while the queue is full and `Pop()` blocks while it is empty.
+ * Once `Close()` is called, consumers drain the remaining items and then
+ * `Pop()` returns false.
+ ******************************************************************************/
+template <typename T>
+class BoundedQueue {
+    public:
+        /***********************************************************************
+         * Constructor method
+         *
+         * @param[in] capacity  Maximum number of queued items, at least 1
+         **********************************************************************/
+        explicit BoundedQueue(const std::size_t capacity):
+            capacity_(capacity > 0 ? capacity : 1) {}
+
+        /***********************************************************************
+         * Add an item to the back of the queue, waiting for space if needed.
+         *
+         * @param[in] item  Item to add
+         * @return          False if the queue was closed and the item dropped
+         **********************************************************************/
+        bool Push(T item) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_full_.wait(lock, [this] {
+                return closed_ || items_.size() < capacity_;
+            });
+            if (closed_)
+                return false;
+            items_.push_back(std::move(item));
+            not_empty_.notify_one();
+            return true;
+        }
+
+        /***********************************************************************
+         * Remove the item at the front of the queue, waiting for one if needed.
+         *
+         * @param[out] item  Item removed from the queue
+         * @return           False once the queue is closed and empty
+         **********************************************************************/
+        bool Pop(T &item) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this] {
+                return closed_ || !items_.empty();
+            });
+            if (items_.empty())
+                return false;
+            item = std::move(items_.front());
+            items_.pop_front();
+            not_full_.notify_one();
+            return true;
+        }
+
+        /** Stop accepting items and wake every waiting thread */
+        void Close() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            not_empty_.notify_all();
+            not_full_.notify_all();
+        }
+
+    private:
+        const std::size_t capacity_;        /**< Maximum number of items */
+        std::deque<T> items_;               /**< Queued items            */
+        bool closed_ = false;               /**< True once closed        */
+        std::mutex mutex_;                  /**< Guards all members      */
+        std::condition_variable not_empty_; /**< Signaled on push/close  */
+        std::condition_variable not_full_;  /**< Signaled on pop/close   */
+};
+
+/** Reads the next scenario; returns false at the end of the input */
+using BatchReader = std::function<bool(BatchScenario &)>;
+/** Writes one evaluated scenario; called in input order */
+using BatchWriter = std::function<void(const BatchScenario &)>;
+
+DrvrReturnCode RunBatchPipeline(
+    const BatchReader &read,
+    const BatchWriter &write,
+    const unsigned int n_workers,
+    const std::size_t capacity
+);
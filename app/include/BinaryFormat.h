@@ -0,0 +1,55 @@
+/** @file BinaryFormat.h
+ * Layout of the binary columnar batch input and output files of the driver.
+ *
+ * Both files are little-endian and begin with a 16-byte header: an 8-byte
+ * ASCII magic string, then the number of scenarios `n` as a uint64. The
+ * header is followed by one column after another, each a contiguous array of
+ * `n` values, so that every column is aligned to the size of its values and
+ * may be used in place by memory-mapping the file.
+ *
+ * Input file, magic `BINARY_INPUT_MAGIC`:
+ *   | Column        | Type    | Description                            |
+ *   |---------------|---------|----------------------------------------|
+ *   | h_tx__meter   | float64 | Height of the transmitter, in meters   |
+ *   | h_rx__meter   | float64 | Height of the receiver, in meters      |
+ *   | f__mhz        | float64 | Frequency, in MHz                      |
+ *   | P_tx__watt    | float64 | Transmitter power, in watts            |
+ *   | N_s           | float64 | Surface refractivity, in N-Units       |
+ *   | d__km         | float64 | Path distance, in km                   |
+ *   | epsilon       | float64 | Relative permittivity                  |
+ *   | sigma         | float64 | Conductivity, in siemens per meter     |
+ *   | pol           | int32   | Polarization, 0 = Horiz., 1 = Vertical |
+ *
+ * Output file, magic `BINARY_OUTPUT_MAGIC`:
+ *   | Column        | Type    | Description                            |
+ *   |---------------|---------|----------------------------------------|
+ *   | A_btl__db     | float64 | Basic transmission loss, in dB         |
+ *   | E_dBuVm       | float64 | Electric field strength, in dB(uV/m)   |
+ *   | P_rx__dbm     | float64 | Received power, in dBm                 |
+ *   | method        | int32   | Solution method (`SolutionMethod`)     |
+ *   | rtn           | int32   | Return code (`ReturnCode`)             |
+ *
+ * Output value `i` describes input scenario `i`. When `rtn[i]` is not
+ * `SUCCESS`, the float64 outputs are NaN and `method[i]` is -1.
+ */
+#pragma once
+
+#include <cstddef>  // for std::size_t
+
+/** Magic string which starts a binary input file */
+constexpr char BINARY_INPUT_MAGIC[8] = {'L', 'F', 'M', 'F', '-', 'I', 'N', '1'};
+
+/** Magic string which starts a binary output file */
+constexpr char BINARY_OUTPUT_MAGIC[8] = {'L', 'F', 'M', 'F', 'O', 'U', 'T', '1'};
+
+/** Size of the header of binary files, in bytes */
+constexpr std::size_t BINARY_HEADER_SIZE = 16;
+
+/** Number of float64 columns of a binary input file */
+constexpr std::size_t BINARY_INPUT_DOUBLE_COLUMNS = 8;
+
+/** Number of float64 columns of a binary output file */
+constexpr std::size_t BINARY_OUTPUT_DOUBLE_COLUMNS = 3;
+
+/** Number of int32 columns of a binary output file */
+constexpr std::size_t BINARY_OUTPUT_INT_COLUMNS = 2;
@@ -0,0 +1,44 @@
+/** @file CsvBatchReader.h
+ * Reader class for batch input files with one scenario per CSV row.
+ */
+#pragma once
+
+#include "BatchPipeline.h"
+#include "ReturnCodes.h"
+
+#include <cstddef>  // for std::size_t
+#include <istream>  // for std::istream
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+/*******************************************************************************
+ * @class CsvBatchReader
+ * Reads LFMF scenarios from a CSV stream, one scenario per row.
+ *
+ * The first non-empty line is a header naming every column. Each of the
+ * `LFMFInputKeys` must appear exactly once, in any order and in any case. Each
+ * following non-empty line is one scenario. Only the current line is held in
+ * memory, so memory use does not depend on the length of the stream.
+ ******************************************************************************/
+class CsvBatchReader {
+    public:
+        /***********************************************************************
+         * Constructor method
+         *
+         * @param[in] stream  The input stream which will be read
+         **********************************************************************/
+        CsvBatchReader(std::istream &stream);
+
+        /** Read and validate the header line; call once before `Read()` */
+        DrvrReturnCode ReadHeader();
+
+        /** Read the next row; false at the end of the stream */
+        bool Read(BatchScenario &scenario);
+    private:
+        bool NextLine();
+
+        std::istream &stream_;             /**< Reference to the input stream */
+        std::string line_;                 /**< Current line of the stream    */
+        std::vector<std::string> fields_;  /**< Fields of the current line    */
+        std::vector<std::string> columns_; /**< Input key of each column      */
+};
@@ -4,13 +4,19 @@
 #pragma once
 
 
+#include "BatchPipeline.h"
 #include "CommaSeparatedIterator.h"
+#include "CsvBatchReader.h"
+#include "MappedCsvBatchReader.h"
+#include "MappedFile.h"
 #include "LFMF.h"
 #include "ReturnCodes.h"
 #include "Structs.h"
 
 #include <iomanip>   // for std::left, std::setw
+#include <fstream>   // for std::ofstream
 #include <iostream>  // for std::cout
+#include <istream>   // for std::istream
 #include <ostream>   // for std::endl, std::ostream
 #include <string>    // for std::string
 
@@ -31,12 +37,18 @@ using namespace ITS::Propagation::LFMF;
 void Help(std::ostream &os = std::cout);
 DrvrReturnCode ParseArguments(int argc, char **argv, DrvrParams &params);
 DrvrReturnCode ValidateInputs(const DrvrParams &params);
+DrvrReturnCode RunBatch(const DrvrParams &params, int argc, char **argv);
+DrvrReturnCode RunBinaryBatch(const DrvrParams &params);
+DrvrReturnCode RunServer(const DrvrParams &params);
+void WriteReportHeader(std::ofstream &fp, int argc, char **argv);
 
 // Driver Utils
 std::string GetDatetimeString();
 DrvrReturnCode ParseBoolean(const std::string &str, bool &value);
 DrvrReturnCode ParseDouble(const std::string &str, double &value);
+DrvrReturnCode ParseDouble(const char *first, const char *last, double &value);
 DrvrReturnCode ParseInteger(const std::string &str, int &value);
+DrvrReturnCode ParseInteger(const char *first, const char *last, int &value);
 void PrintLabel(std::ostream &os, const std::string &lbl);
 void StringToLower(std::string &str);
 void Version(std::ostream &os = std::cout);
@@ -45,5 +57,14 @@ void Version(std::ostream &os = std::cout);
 ReturnCode CallLFMFModel(LFMFParams &lfmf_params, Result &result);
 DrvrReturnCode
     ParseLFMFInputFile(const std::string &in_file, LFMFParams &lfmf_params);
+DrvrReturnCode
+    ParseLFMFInputStream(std::istream &stream, LFMFParams &lfmf_params);
+DrvrReturnCode ParseLFMFValue(
+    const std::string &key, const std::string &value, LFMFParams &lfmf_params
+);
+bool ReadLFMFInputBlock(std::istream &stream, BatchScenario &scenario);
 void WriteLFMFInputs(std::ofstream &fp, const LFMFParams &params);
 void WriteLFMFOutputs(std::ofstream &fp, const Result &result);
+void WriteLFMFScenario(std::ofstream &fp, const BatchScenario &scenario);
+void WriteLFMFCsvHeader(std::ostream &os);
+void WriteLFMFCsvRow(std::ostream &os, const BatchScenario &scenario);
@@ -0,0 +1,47 @@
+/** @file MappedCsvBatchReader.h
+ * Reader class which scans CSV batch input in place, without copying lines.
+ */
+#pragma once
+
+#include "BatchPipeline.h"
+#include "ReturnCodes.h"
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+/*******************************************************************************
+ * @class MappedCsvBatchReader
+ * Reads LFMF scenarios, one per row, from CSV contents held in memory, such as
+ * a `MappedFile`.
+ *
+ * Accepts the same format as `CsvBatchReader`. Rows are split and their
+ * numbers parsed directly from the buffer, without allocating. Parsing errors
+ * are printed with the line and column at which they were found.
+ ******************************************************************************/
+class MappedCsvBatchReader {
+    public:
+        /***********************************************************************
+         * Constructor method
+         *
+         * @param[in] data  First byte of the CSV contents
+         * @param[in] size  Number of bytes of CSV contents
+         **********************************************************************/
+        MappedCsvBatchReader(const char *data, const std::size_t size);
+
+        /** Read and validate the header line; call once before `Read()` */
+        DrvrReturnCode ReadHeader();
+
+        /** Read the next row; false at the end of the contents */
+        bool Read(BatchScenario &scenario);
+    private:
+        bool NextLine(const char *&first, const char *&last);
+        void ReportError(
+            const DrvrReturnCode rtn, const char *at, const int column
+        ) const;
+
+        const char *pos_;          /**< Start of the next unread line       */
+        const char *end_;          /**< End of the contents                 */
+        const char *line_start_;   /**< Start of the current line           */
+        std::size_t line_ = 0;     /**< Line number of the current line     */
+        std::vector<int> columns_; /**< Input parameter index of each column */
+};
@@ -0,0 +1,47 @@
+/** @file MappedFile.h
+ * Class for read-only memory-mapped access to input files.
+ */
+#pragma once
+
+#include <cstddef>  // for std::size_t
+#include <string>   // for std::string
+
+/*******************************************************************************
+ * @class MappedFile
+ * Maps the whole of a regular file into memory, read-only.
+ *
+ * The contents can be scanned in place without copying them into strings.
+ * The mapping is released when the object is destroyed. Opening fails for
+ * files which cannot be mapped, such as pipes, so callers can fall back to
+ * reading the file as a stream.
+ ******************************************************************************/
+class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /***********************************************************************
+         * Map a file into memory
+         *
+         * @param[in] path  Path of the file to map
+         * @return          True if the file was mapped
+         **********************************************************************/
+        bool Open(const std::string &path);
+
+        /** First byte of the file contents; null for an empty file */
+        const char *data() const { return data_; }
+
+        /** Number of bytes in the file */
+        std::size_t size() const { return size_; }
+    private:
+        void Close();
+
+        const char *data_ = nullptr; /**< Start of the mapping  */
+        std::size_t size_ = 0;       /**< Length of the mapping */
+#ifdef _WIN32
+        void *file_ = nullptr;    /**< Handle of the open file        */
+        void *mapping_ = nullptr; /**< Handle of the file mapping     */
+#endif
+};
@@ -17,6 +17,10 @@ enum DrvrReturnCode {
     DRVRERR__INVALID_OPTION,                /**< Unknown option specified */
     DRVRERR__OPENING_INPUT_FILE,            /**< Failed to open the input file for reading */
     DRVRERR__OPENING_OUTPUT_FILE,           /**< Failed to open the output file for writing */
+    DRVRERR__INVALID_THREAD_COUNT,          /**< Thread count is not a non-negative integer */
+    DRVRERR__SERVER_SOCKET,                 /**< Failed to set up the server socket */
+    DRVRERR__WRITING_OUTPUT_FILE,           /**< Failed to write the output file */
+    DRVRERR__BATCH_THREAD,                  /**< A batch thread failed to start or to run */
 
     // Input File Parsing Errors
     DRVRERR__PARSE = 160,                   /**< Failed parsing inputs; unknown parameter */
@@ -29,6 +33,9 @@ enum DrvrReturnCode {
     DRVRERR__PARSE_EPSILON,                 /**< Failed to parse epsilon value */
     DRVRERR__PARSE_SIGMA,                   /**< Failed to parse sigma value */
     DRVRERR__PARSE_POLARIZATION,            /**< Failed to parse polarization value */
+    DRVRERR__PARSE_CSV_HEADER,              /**< CSV header has an unknown, repeated or missing column */
+    DRVRERR__PARSE_CSV_ROW,                 /**< CSV row has the wrong number of columns */
+    DRVRERR__PARSE_BINARY_HEADER,           /**< Binary input has an invalid header or the wrong size */
 
     // Validation Errors
     DRVRERR__VALIDATION_IN_FILE = 192,      /**< Input file not specified */
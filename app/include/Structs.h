@@ -10,8 +10,14 @@
 
 /** Parameters provided to the command line driver */
 struct DrvrParams {
-        std::string in_file = "";  /**< Input file */
-        std::string out_file = ""; /**< Output file */
+        std::string in_file = "";     /**< Input file */
+        std::string out_file = "";    /**< Output file */
+        bool batch = false;           /**< Input file has many scenarios */
+        bool csv = false;             /**< Batch files are CSV */
+        bool binary = false;          /**< Batch files are binary */
+        unsigned int n_threads = 0;   /**< Batch compute threads; 0 for all */
+        bool serve = false;           /**< Run as a server */
+        std::string socket_path = ""; /**< Server socket; empty for stdin */
 };
 
 /** Input parameters for the LFMF Model */
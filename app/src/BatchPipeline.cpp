@@ -0,0 +1,187 @@
+/** @file BatchPipeline.cpp
+ * Implements a pipelined batch run with overlapping reading, model evaluation
+ * and writing.
+ */
+#include "BatchPipeline.h"
+
+#include "Driver.h"
+
+#include <algorithm>           // for std::max
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <mutex>               // for std::lock_guard, std::mutex, std::unique_lock
+#include <thread>              // for std::thread
+#include <utility>             // for std::move
+#include <vector>              // for std::vector
+
+/*******************************************************************************
+ * Run the LFMF Model for every scenario of a batch, overlapping input parsing,
+ * model evaluation and output writing.
+ *
+ * A reader thread calls `read` for each scenario and places it on a bounded
+ * work queue. A pool of `n_workers` compute threads evaluates the model for
+ * every scenario which was parsed without error. A writer thread calls
+ * `write` for each evaluated scenario, strictly in input order.
+ *
+ * At most `capacity` scenarios are in flight between reading and writing at
+ * any time, so memory use does not depend on the size of the batch. The
+ * reader waits when the writer falls behind, including when the writer is
+ * waiting on a slow scenario which was read earlier than the others.
+ *
+ * If a thread cannot be started, or `read`, `write` or the model throws, the
+ * batch stops: every thread which was started is joined, and the failure is
+ * returned. Scenarios already written are kept.
+ *
+ * @param[in] read       Reads the next scenario; false at the end of input
+ * @param[in] write      Writes one evaluated scenario
+ * @param[in] n_workers  Number of compute threads; 0 for one per hardware
+ *                       thread
+ * @param[in] capacity   Maximum number of scenarios in flight
+ * @return               `DRVR__SUCCESS`; `DRVRERR__WRITING_OUTPUT_FILE` if
+ *                       `write` threw; otherwise `DRVRERR__BATCH_THREAD` if
+ *                       the batch stopped
+ ******************************************************************************/
+DrvrReturnCode RunBatchPipeline(
+    const BatchReader &read,
+    const BatchWriter &write,
+    const unsigned int n_workers,
+    const std::size_t capacity
+) {
+    const unsigned int n_compute
+        = n_workers > 0 ? n_workers
+                        : std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t window = std::max<std::size_t>(capacity, 1);
+
+    BoundedQueue<BatchScenario> work(window);
+
+    // Evaluated scenarios waiting to be written, in slot `index % window`
+    std::vector<BatchScenario> slots(window);
+    std::vector<bool> ready(window, false);
+    std::size_t n_read = 0;     // Scenarios read so far
+    std::size_t n_written = 0;  // Scenarios written so far
+    bool done_reading = false;  // True once `read` reached the end of input
+    bool stopped = false;       // True once a failure stopped the batch
+    std::mutex mutex;           // Guards the slots, counters and flags above
+    std::condition_variable changed;
+    DrvrReturnCode rtn = DRVR__SUCCESS;  // The failure which stopped the batch
+
+    // Stop the batch, waking every thread so that it can return
+    auto stop = [&](const DrvrReturnCode failure) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!stopped) {
+                stopped = true;
+                rtn = failure;
+            }
+            changed.notify_all();
+        }
+        work.Close();
+    };
+
+    std::thread reader;
+    try {
+        reader = std::thread([&] {
+            try {
+                while (true) {
+                    {
+                        // Wait for a free slot, so that no more than `window`
+                        // scenarios are in flight
+                        std::unique_lock<std::mutex> lock(mutex);
+                        changed.wait(lock, [&] {
+                            return stopped || n_read - n_written < window;
+                        });
+                        if (stopped)
+                            break;
+                    }
+
+                    BatchScenario scenario;
+                    if (!read(scenario))
+                        break;
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        scenario.index = n_read++;
+                    }
+                    if (!work.Push(std::move(scenario)))
+                        break;  // The batch was stopped
+                }
+            } catch (...) {
+                stop(DRVRERR__BATCH_THREAD);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            done_reading = true;
+            work.Close();
+            changed.notify_all();
+        });
+    } catch (...) {
+        return DRVRERR__BATCH_THREAD;  // No thread was started
+    }
+
+    std::vector<std::thread> workers;
+    std::thread writer;
+    try {
+        workers.reserve(n_compute);
+        for (unsigned int t = 0; t < n_compute; t++) {
+            workers.emplace_back([&] {
+                BatchScenario scenario;
+                while (work.Pop(scenario)) {
+                    try {
+                        if (scenario.parse_rtn == DRVR__SUCCESS)
+                            scenario.rtn = CallLFMFModel(
+                                scenario.params, scenario.result
+                            );
+                    } catch (...) {
+                        stop(DRVRERR__BATCH_THREAD);
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    const std::size_t slot = scenario.index % window;
+                    slots[slot] = std::move(scenario);
+                    ready[slot] = true;
+                    changed.notify_all();
+                }
+            });
+        }
+
+        writer = std::thread([&] {
+            for (std::size_t next = 0;; next++) {
+                const std::size_t slot = next % window;
+                BatchScenario scenario;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&] {
+                        return stopped || ready[slot]
+                            || (done_reading && next >= n_read);
+                    });
+                    if (stopped || !ready[slot])
+                        return;  // Every scenario has been written, or the
+                                 // batch was stopped
+                    scenario = std::move(slots[slot]);
+                    ready[slot] = false;
+                }
+
+                try {
+                    write(scenario);
+                } catch (...) {
+                    stop(DRVRERR__WRITING_OUTPUT_FILE);
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                n_written++;
+                changed.notify_all();
+            }
+        });
+    } catch (...) {
+        // A thread could not be started; stop the ones which were
+        stop(DRVRERR__BATCH_THREAD);
+    }
+
+    reader.join();
+    for (std::thread &worker : workers)
+        worker.join();
+    if (writer.joinable())
+        writer.join();
+    return rtn;
+}
@@ -0,0 +1,139 @@
+/** @file CsvBatchReader.cpp
+ * Implementation of class to read batch scenarios from CSV input streams.
+ */
+#include "CsvBatchReader.h"
+
+#include "Driver.h"
+
+#include <algorithm>  // for std::count
+#include <cstddef>    // for std::size_t
+#include <iostream>   // for std::cerr
+#include <istream>    // for std::istream
+#include <ostream>    // for std::endl
+#include <string>     // for std::getline, std::string
+#include <vector>     // for std::vector
+
+namespace {
+
+/*******************************************************************************
+ * Split a line into its comma-separated fields, trimming surrounding spaces.
+ *
+ * The strings in `fields` are reused between calls, so that splitting a line
+ * of similar length does not allocate.
+ *
+ * @param[in]  line    Line to split
+ * @param[out] fields  Fields of the line
+ ******************************************************************************/
+void SplitCsvLine(const std::string &line, std::vector<std::string> &fields) {
+    const std::size_t n = std::count(line.begin(), line.end(), ',') + 1;
+    fields.resize(n);
+
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t end = line.find(',', begin);
+        if (end == std::string::npos)
+            end = line.size();
+
+        std::size_t first = begin;
+        std::size_t last = end;
+        while (first < last && (line[first] == ' ' || line[first] == '\t'))
+            first++;
+        while (last > first && (line[last - 1] == ' ' || line[last - 1] == '\t'))
+            last--;
+        fields[i].assign(line, first, last - first);
+
+        begin = end + 1;
+    }
+}
+
+}  // namespace
+
+CsvBatchReader::CsvBatchReader(std::istream &stream): stream_(stream) {}
+
+/***********************************************************************
+ * Read the next non-empty line of the stream into `line_`.
+ *
+ * @return False if the end of the stream was reached.
+ **********************************************************************/
+bool CsvBatchReader::NextLine() {
+    while (std::getline(stream_, line_)) {
+        if (!line_.empty() && line_.back() == '\r')
+            line_.pop_back();
+        if (!line_.empty())
+            return true;
+    }
+    return false;
+}
+
+/***********************************************************************
+ * Read and validate the header line.
+ *
+ * @return Return code; `DRVRERR__PARSE_CSV_HEADER` if a column is not one
+ *         of the `LFMFInputKeys`, or any of them is repeated or missing
+ **********************************************************************/
+DrvrReturnCode CsvBatchReader::ReadHeader() {
+    const std::vector<std::string> keys = {
+        LFMFInputKeys::h_tx__meter,
+        LFMFInputKeys::h_rx__meter,
+        LFMFInputKeys::f__mhz,
+        LFMFInputKeys::P_tx__watt,
+        LFMFInputKeys::N_s,
+        LFMFInputKeys::d__km,
+        LFMFInputKeys::epsilon,
+        LFMFInputKeys::sigma,
+        LFMFInputKeys::pol
+    };
+
+    columns_.clear();
+    if (NextLine()) {
+        SplitCsvLine(line_, columns_);
+    }
+    for (std::string &column : columns_) {
+        StringToLower(column);
+    }
+
+    bool valid = columns_.size() == keys.size();
+    for (const std::string &key : keys) {
+        if (std::count(columns_.begin(), columns_.end(), key) != 1)
+            valid = false;
+    }
+    if (!valid) {
+        std::cerr << "CSV header must name each of the columns";
+        for (const std::string &key : keys) {
+            std::cerr << " " << key;
+        }
+        std::cerr << " exactly once" << std::endl;
+        return DRVRERR__PARSE_CSV_HEADER;
+    }
+    return DRVR__SUCCESS;
+}
+
+/***********************************************************************
+ * Read the next row as a scenario.
+ *
+ * Parsing errors are stored in `scenario.parse_rtn` and do not stop the
+ * batch.
+ *
+ * @param[out] scenario  Scenario with its parsed inputs and return code
+ * @return               False if the end of the stream was reached
+ **********************************************************************/
+bool CsvBatchReader::Read(BatchScenario &scenario) {
+    if (!NextLine())
+        return false;
+
+    SplitCsvLine(line_, fields_);
+    scenario.params = LFMFParams{};
+    if (fields_.size() != columns_.size()) {
+        scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+        return true;
+    }
+
+    scenario.parse_rtn = DRVR__SUCCESS;
+    for (std::size_t i = 0; i < fields_.size(); i++) {
+        scenario.parse_rtn
+            = ParseLFMFValue(columns_[i], fields_[i], scenario.params);
+        if (scenario.parse_rtn != DRVR__SUCCESS)
+            break;
+    }
+    return true;
+}
@@ -4,14 +4,19 @@
 #include "Driver.h"
 
 #include <algorithm>  // for std::find
+#include <cstddef>    // for std::size_t
 #include <fstream>    // for std::ifstream, std::ofstream
 #include <iomanip>    // for std::setw
 #include <ios>        // for std::left
 #include <iostream>   // for std::cerr
+#include <memory>     // for std::unique_ptr
 #include <ostream>    // for std::endl
 #include <string>     // for std::string
 #include <vector>     // for std::vector
 
+/** Maximum number of scenarios in flight in the batch pipeline */
+constexpr std::size_t BATCH_PIPELINE_CAPACITY = 1024;
+
 /*******************************************************************************
  * Main function of the driver executable
  * 
@@ -32,6 +37,11 @@ int main(int argc, char **argv) {
         return rtn;
     }
 
+    if (params.serve) {
+        rtn = RunServer(params);
+        return rtn == DRVR__SUCCESS ? SUCCESS : rtn;
+    }
+
     // Ensure required options were provided
     rtn = ValidateInputs(params);
     if (rtn != DRVR__SUCCESS) {
@@ -39,6 +49,11 @@ int main(int argc, char **argv) {
         return rtn;
     }
 
+    if (params.batch) {
+        rtn = RunBatch(params, argc, argv);
+        return rtn == DRVR__SUCCESS ? SUCCESS : rtn;
+    }
+
     // Initialize model inputs/outputs
     LFMFParams lfmf_params;
     Result result;
@@ -63,15 +78,7 @@ int main(int argc, char **argv) {
     }
 
     // Print generator information to file
-    fp << std::left << std::setw(30) << "Model" << LIBRARY_NAME;
-    fp PRINT "Library Version" << "v" << LIBRARY_VERSION;
-    fp PRINT "Driver Version" << "v" << DRIVER_VERSION;
-    fp PRINT "Date Generated" << GetDatetimeString();
-    fp PRINT "Input Arguments";
-    for (int i = 1; i < argc; i++) {
-        fp << argv[i] << " ";
-    }
-    fp << std::endl << std::endl;
+    WriteReportHeader(fp, argc, argv);
 
     // Print inputs to file
     fp << "Inputs:";
@@ -98,7 +105,8 @@ int main(int argc, char **argv) {
  ******************************************************************************/
 DrvrReturnCode ParseArguments(int argc, char **argv, DrvrParams &params) {
     const std::vector<std::string> validArgs
-        = {"-i", "-o", "-h", "--help", "-v", "--version"};
+        = {"-i",     "-o",      "-b", "-csv",   "-bin", "-t",
+           "-serve", "-socket", "-h", "--help", "-v",   "--version"};
 
     for (int i = 1; i < argc; i++) {
         // Parse arg to lowercase string
@@ -120,6 +128,20 @@ DrvrReturnCode ParseArguments(int argc, char **argv, DrvrParams &params) {
         } else if (arg == "-h" || arg == "--help") {
             Help();
             return DRVR__RETURN_SUCCESS;
+        } else if (arg == "-b") {
+            params.batch = true;
+            continue;
+        } else if (arg == "-csv") {
+            params.batch = true;
+            params.csv = true;
+            continue;
+        } else if (arg == "-bin") {
+            params.batch = true;
+            params.binary = true;
+            continue;
+        } else if (arg == "-serve") {
+            params.serve = true;
+            continue;
         }
 
         // Check if end of arguments reached or next argument is another flag
@@ -135,6 +157,20 @@ DrvrReturnCode ParseArguments(int argc, char **argv, DrvrParams &params) {
         } else if (arg == "-o") {
             params.out_file = argv[i + 1];
             i++;
+        } else if (arg == "-t") {
+            int n_threads;
+            if (ParseInteger(argv[i + 1], n_threads) != DRVR__SUCCESS
+                || n_threads < 0) {
+                std::cerr << "Error: invalid thread count " << argv[i + 1]
+                          << std::endl;
+                return DRVRERR__INVALID_THREAD_COUNT;
+            }
+            params.n_threads = static_cast<unsigned int>(n_threads);
+            i++;
+        } else if (arg == "-socket") {
+            params.serve = true;
+            params.socket_path = argv[i + 1];
+            i++;
         }
     }
 
@@ -151,11 +187,25 @@ void Help(std::ostream &os) {
     os << "Options (not case sensitive)" << std::endl;
     os << "\t-i      :: Input file name" << std::endl;
     os << "\t-o      :: Output file name" << std::endl;
+    os << "\t-b      :: Batch mode: the input file holds many scenarios,"
+       << " separated by empty lines" << std::endl;
+    os << "\t-csv    :: Batch mode with CSV input and output: one row for"
+       << " each scenario" << std::endl;
+    os << "\t-bin    :: Batch mode with binary columnar input and output"
+       << " (see BinaryFormat.h)" << std::endl;
+    os << "\t-t      :: Batch mode compute threads (default: all)"
+       << std::endl;
+    os << "\t-serve  :: Server mode: answer one request per line of stdin,"
+       << " with the input values in order" << std::endl;
+    os << "\t-socket :: Server mode on the given Unix domain socket path"
+       << std::endl;
     os << std::endl << "Examples:" << std::endl;
     os << "\t[WINDOWS] " << DRIVER_NAME << ".exe -i inputs.txt -o results.txt"
        << std::endl;
     os << "\t[LINUX]   .\\" << DRIVER_NAME << " -i in.txt -o results.txt"
        << std::endl;
+    os << "\t[LINUX]   .\\" << DRIVER_NAME
+       << " -b -t 4 -i batch.txt -o results.txt" << std::endl;
     os << "Other Options (which don't run the model)" << std::endl;
     os << "\t-h      :: Display this help message" << std::endl;
     os << "\t-v      :: Display program version information" << std::endl;
@@ -184,3 +234,144 @@ DrvrReturnCode ValidateInputs(const DrvrParams &params) {
 
     return rtn;
 }
+
+/*******************************************************************************
+ * Run the model for every scenario of a batch input file.
+ * 
+ * The input file is read, the scenarios are evaluated, and the report is
+ * written concurrently by `RunBatchPipeline()`. Scenarios appear in the report
+ * in the same order as in the input file. Parsing and model errors are
+ * reported for each scenario and do not stop the batch.
+ * 
+ * With the `-csv` option, the input file is scanned in place by
+ * `MappedCsvBatchReader` (or read by `CsvBatchReader` when it cannot be
+ * memory-mapped) and the output file holds one CSV row per scenario, without
+ * a report header. With the `-bin` option, the files are binary and the run
+ * is done by `RunBinaryBatch()`.
+ * 
+ * @param[in] params  Structure with user input parameters
+ * @param[in] argc    Number of command line arguments, for the report header
+ * @param[in] argv    Command line arguments, for the report header
+ * @return            Return code
+ ******************************************************************************/
+DrvrReturnCode RunBatch(const DrvrParams &params, int argc, char **argv) {
+    if (params.binary) {
+        return RunBinaryBatch(params);
+    }
+
+    std::ifstream in_file(params.in_file);
+    if (!in_file) {
+        std::cerr << "Failed to open file " << params.in_file << std::endl;
+        return DRVRERR__OPENING_INPUT_FILE;
+    }
+
+    std::ofstream fp(params.out_file);
+    if (!fp) {
+        std::cerr << "Error opening output file. Exiting." << std::endl;
+        return DRVRERR__OPENING_OUTPUT_FILE;
+    }
+
+    if (params.csv) {
+        // Scan the input in place when it can be memory-mapped, and otherwise
+        // (e.g., for a pipe) read it line by line
+        MappedFile mapped;
+        std::unique_ptr<MappedCsvBatchReader> mapped_reader;
+        std::unique_ptr<CsvBatchReader> stream_reader;
+        BatchReader read;
+        DrvrReturnCode rtn;
+        if (mapped.Open(params.in_file)) {
+            mapped_reader.reset(
+                new MappedCsvBatchReader(mapped.data(), mapped.size())
+            );
+            rtn = mapped_reader->ReadHeader();
+            read = [&mapped_reader](BatchScenario &scenario) {
+                return mapped_reader->Read(scenario);
+            };
+        } else {
+            stream_reader.reset(new CsvBatchReader(in_file));
+            rtn = stream_reader->ReadHeader();
+            read = [&stream_reader](BatchScenario &scenario) {
+                return stream_reader->Read(scenario);
+            };
+        }
+        if (rtn != DRVR__SUCCESS) {
+            return rtn;
+        }
+
+        WriteLFMFCsvHeader(fp);
+        rtn = RunBatchPipeline(
+            read,
+            [&fp](const BatchScenario &scenario) {
+                WriteLFMFCsvRow(fp, scenario);
+            },
+            params.n_threads,
+            BATCH_PIPELINE_CAPACITY
+        );
+        if (rtn != DRVR__SUCCESS) {
+            std::cerr << GetDrvrReturnStatusMsg(rtn) << std::endl;
+            return rtn;
+        }
+
+        // A failed write, such as to a full disk, sets the stream state
+        if (!fp) {
+            std::cerr << "Error writing output file. Exiting." << std::endl;
+            return DRVRERR__WRITING_OUTPUT_FILE;
+        }
+        fp.close();
+        if (!fp) {
+            std::cerr << "Error writing output file. Exiting." << std::endl;
+            return DRVRERR__WRITING_OUTPUT_FILE;
+        }
+        return DRVR__SUCCESS;
+    }
+
+    WriteReportHeader(fp, argc, argv);
+    fp << "Batch Results:";
+
+    const DrvrReturnCode rtn = RunBatchPipeline(
+        [&in_file](BatchScenario &scenario) {
+            return ReadLFMFInputBlock(in_file, scenario);
+        },
+        [&fp](const BatchScenario &scenario) {
+            WriteLFMFScenario(fp, scenario);
+        },
+        params.n_threads,
+        BATCH_PIPELINE_CAPACITY
+    );
+    if (rtn != DRVR__SUCCESS) {
+        std::cerr << GetDrvrReturnStatusMsg(rtn) << std::endl;
+        return rtn;
+    }
+
+    // A failed write, such as to a full disk, sets the stream state
+    fp << std::endl;
+    if (!fp) {
+        std::cerr << "Error writing output file. Exiting." << std::endl;
+        return DRVRERR__WRITING_OUTPUT_FILE;
+    }
+    fp.close();
+    if (!fp) {
+        std::cerr << "Error writing output file. Exiting." << std::endl;
+        return DRVRERR__WRITING_OUTPUT_FILE;
+    }
+    return DRVR__SUCCESS;
+}
+
+/*******************************************************************************
+ * Write the generator information which starts every report file
+ * 
+ * @param[in] fp    Output stream, a text file open for writing
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ ******************************************************************************/
+void WriteReportHeader(std::ofstream &fp, int argc, char **argv) {
+    fp << std::left << std::setw(30) << "Model" << LIBRARY_NAME;
+    fp PRINT "Library Version" << "v" << LIBRARY_VERSION;
+    fp PRINT "Driver Version" << "v" << DRIVER_VERSION;
+    fp PRINT "Date Generated" << GetDatetimeString();
+    fp PRINT "Input Arguments";
+    for (int i = 1; i < argc; i++) {
+        fp << argv[i] << " ";
+    }
+    fp << std::endl << std::endl;
+}
@@ -14,14 +14,22 @@
 #endif
 
 #include <algorithm>  // for std::transform
-#include <cctype>     // for std::tolower
+#include <cctype>     // for std::isspace, std::tolower
+#include <cerrno>     // for errno, ERANGE
+#include <climits>    // for INT_MAX, INT_MIN
+#include <clocale>    // for std::localeconv
 #include <cstddef>    // for std::size_t
+#include <cstdlib>    // for std::strtod, std::strtol
+#include <cstring>    // for std::memcpy
 #include <ctime>      // for localtime_{s,r}, std::{time, time_t, tm, strftime}
 #include <iomanip>    // for std::setfill, std::setw
 #include <iostream>   // for std::cerr, std::endl
 #include <ostream>    // for std::ostream
 #include <string>     // for std::stod, std::stoi, std::string
 
+/** Longest number, in characters, accepted when parsing a range of characters */
+constexpr std::size_t NUMBER_BUFFER_SIZE = 64;
+
 /******************************************************************************
  * Get a string containing the current date and time information.
  * 
@@ -90,6 +98,82 @@ DrvrReturnCode ParseDouble(const std::string &str, double &value) {
     return DRVR__SUCCESS;
 }
 
+/*******************************************************************************
+ * Parse a double value from a range of characters, such as a field of a
+ * memory-mapped input file, without allocating.
+ * 
+ * The whole range must be a number; surrounding whitespace is not accepted.
+ * The number is read as in the "C" locale, with '.' as its decimal point,
+ * whatever the current locale of the program.
+ * 
+ * @param[in]  first  Start of the characters to parse
+ * @param[in]  last   End of the characters to parse
+ * @param[out] value  Parsed value
+ * @return            Return code
+ ******************************************************************************/
+DrvrReturnCode ParseDouble(const char *first, const char *last, double &value) {
+    // Copy into a terminated buffer, since the range need not be terminated
+    char buf[NUMBER_BUFFER_SIZE];
+    const std::size_t len = static_cast<std::size_t>(last - first);
+    if (len == 0 || len >= sizeof(buf))
+        return DRVRERR__PARSE;
+    // std::strtod() would skip leading whitespace
+    if (std::isspace(static_cast<unsigned char>(*first)))
+        return DRVRERR__PARSE;
+    std::memcpy(buf, first, len);
+    buf[len] = '\0';
+
+    // std::strtod() reads the decimal point of the current locale, so swap
+    // it in for '.' and reject it where it was written itself
+    const char point = *std::localeconv()->decimal_point;
+    if (point != '.') {
+        for (std::size_t k = 0; k < len; k++) {
+            if (buf[k] == point)
+                return DRVRERR__PARSE;
+            if (buf[k] == '.')
+                buf[k] = point;
+        }
+    }
+
+    char *end;
+    value = std::strtod(buf, &end);
+    if (end != buf + len)
+        return DRVRERR__PARSE;
+    return DRVR__SUCCESS;
+}
+
+/*******************************************************************************
+ * Parse an integer value from a range of characters, such as a field of a
+ * memory-mapped input file, without allocating.
+ * 
+ * The whole range must be a number; surrounding whitespace is not accepted.
+ * 
+ * @param[in]  first  Start of the characters to parse
+ * @param[in]  last   End of the characters to parse
+ * @param[out] value  Parsed value
+ * @return            Return code
+ ******************************************************************************/
+DrvrReturnCode ParseInteger(const char *first, const char *last, int &value) {
+    char buf[NUMBER_BUFFER_SIZE];
+    const std::size_t len = static_cast<std::size_t>(last - first);
+    if (len == 0 || len >= sizeof(buf))
+        return DRVRERR__PARSE;
+    // std::strtol() would skip leading whitespace
+    if (std::isspace(static_cast<unsigned char>(*first)))
+        return DRVRERR__PARSE;
+    std::memcpy(buf, first, len);
+    buf[len] = '\0';
+
+    char *end;
+    errno = 0;
+    const long parsed = std::strtol(buf, &end, 10);
+    if (end != buf + len || errno == ERANGE || parsed < INT_MIN
+        || parsed > INT_MAX)
+        return DRVRERR__PARSE;
+    value = static_cast<int>(parsed);
+    return DRVR__SUCCESS;
+}
+
 /*******************************************************************************
  * Parse an integer value read from the input parameter file
  * 
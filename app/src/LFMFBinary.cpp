@@ -0,0 +1,249 @@
+/** @file LFMFBinary.cpp
+ * Implements batch runs of the LF/MF Propagation Model on binary columnar
+ * input and output files.
+ */
+#include "Driver.h"
+
+#include "BinaryFormat.h"
+
+#include <algorithm>  // for std::min
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::int32_t, std::uint32_t, std::uint64_t
+#include <cstring>    // for std::memcmp, std::memcpy
+#include <fstream>    // for std::ofstream
+#include <ios>        // for std::ios, std::streamoff
+#include <iostream>   // for std::cerr
+#include <limits>     // for std::numeric_limits
+#include <ostream>    // for std::endl
+#include <vector>     // for std::vector
+
+/** Number of scenarios evaluated and written together in binary batch mode */
+constexpr std::size_t BINARY_CHUNK_SIZE = 65536;
+
+static_assert(sizeof(int) == 4, "Binary int32 columns are read as int");
+static_assert(sizeof(double) == 8, "Binary float64 columns are read as double");
+
+namespace {
+
+/** True if the host stores numbers little-endian, as binary files do */
+bool HostIsLittleEndian() {
+    const std::uint32_t one = 1;
+    unsigned char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+/** Read a little-endian uint64 */
+std::uint64_t LoadUint64(const char *p) {
+    std::uint64_t value = 0;
+    for (int b = 7; b >= 0; b--)
+        value = (value << 8) | static_cast<unsigned char>(p[b]);
+    return value;
+}
+
+/** Read a little-endian float64 */
+double LoadDouble(const char *p) {
+    const std::uint64_t bits = LoadUint64(p);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/** Read a little-endian int32 */
+int LoadInt32(const char *p) {
+    std::uint32_t bits = 0;
+    for (int b = 3; b >= 0; b--)
+        bits = (bits << 8) | static_cast<unsigned char>(p[b]);
+    std::int32_t value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/** Write a little-endian uint64 */
+void StoreUint64(const std::uint64_t value, char *p) {
+    for (int b = 0; b < 8; b++)
+        p[b] = static_cast<char>((value >> (8 * b)) & 0xFF);
+}
+
+/** Write a little-endian float64 */
+void StoreDouble(const double value, char *p) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    StoreUint64(bits, p);
+}
+
+/** Write a little-endian int32 */
+void StoreInt32(const int value, char *p) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int b = 0; b < 4; b++)
+        p[b] = static_cast<char>((bits >> (8 * b)) & 0xFF);
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Run the model for every scenario of a binary columnar input file, writing a
+ * binary columnar output file. See BinaryFormat.h for the file layouts.
+ *
+ * The input file is memory-mapped. On little-endian hosts its columns are
+ * passed to `LFMFBatchParallel()` in place, without copying. Scenarios are
+ * evaluated in chunks of `BINARY_CHUNK_SIZE`, and each chunk of every output
+ * column is written at its final position in the output file, so memory use
+ * does not depend on the number of scenarios.
+ *
+ * @param[in] params  Structure with user input parameters
+ * @return            Return code
+ ******************************************************************************/
+DrvrReturnCode RunBinaryBatch(const DrvrParams &params) {
+    MappedFile mapped;
+    if (!mapped.Open(params.in_file)) {
+        std::cerr << "Failed to map file " << params.in_file << std::endl;
+        return DRVRERR__OPENING_INPUT_FILE;
+    }
+
+    // Check the header, and that the file holds exactly `n` of every column
+    const std::size_t row_size = BINARY_INPUT_DOUBLE_COLUMNS * 8 + 4;
+    const char *data = mapped.data();
+    if (mapped.size() < BINARY_HEADER_SIZE
+        || std::memcmp(data, BINARY_INPUT_MAGIC, 8) != 0) {
+        std::cerr << GetDrvrReturnStatusMsg(DRVRERR__PARSE_BINARY_HEADER)
+                  << std::endl;
+        return DRVRERR__PARSE_BINARY_HEADER;
+    }
+    const std::uint64_t n_rows = LoadUint64(data + 8);
+    const std::size_t body_size = mapped.size() - BINARY_HEADER_SIZE;
+    if (n_rows > body_size / row_size || n_rows * row_size != body_size) {
+        std::cerr << GetDrvrReturnStatusMsg(DRVRERR__PARSE_BINARY_HEADER)
+                  << std::endl;
+        return DRVRERR__PARSE_BINARY_HEADER;
+    }
+    const std::size_t n = static_cast<std::size_t>(n_rows);
+    const char *double_columns = data + BINARY_HEADER_SIZE;
+    const char *pol_column
+        = double_columns + BINARY_INPUT_DOUBLE_COLUMNS * 8 * n;
+
+    std::ofstream fp(params.out_file, std::ios::binary);
+    if (!fp) {
+        std::cerr << "Error opening output file. Exiting." << std::endl;
+        return DRVRERR__OPENING_OUTPUT_FILE;
+    }
+    char header[BINARY_HEADER_SIZE];
+    std::memcpy(header, BINARY_OUTPUT_MAGIC, 8);
+    StoreUint64(n_rows, header + 8);
+    fp.write(header, BINARY_HEADER_SIZE);
+    if (!fp) {
+        std::cerr << "Error writing output file. Exiting." << std::endl;
+        return DRVRERR__WRITING_OUTPUT_FILE;
+    }
+
+    // Byte offset of each output column in the output file
+    std::streamoff out_offsets
+        [BINARY_OUTPUT_DOUBLE_COLUMNS + BINARY_OUTPUT_INT_COLUMNS];
+    for (std::size_t c = 0; c < BINARY_OUTPUT_DOUBLE_COLUMNS; c++)
+        out_offsets[c] = BINARY_HEADER_SIZE + c * 8 * n;
+    for (std::size_t c = 0; c < BINARY_OUTPUT_INT_COLUMNS; c++)
+        out_offsets[BINARY_OUTPUT_DOUBLE_COLUMNS + c] = BINARY_HEADER_SIZE
+            + BINARY_OUTPUT_DOUBLE_COLUMNS * 8 * n + c * 4 * n;
+
+    const bool in_place = HostIsLittleEndian();
+    const std::size_t chunk = std::min(n, BINARY_CHUNK_SIZE);
+    std::vector<double> decoded(in_place ? 0 : BINARY_INPUT_DOUBLE_COLUMNS * chunk);
+    std::vector<int> decoded_pol(in_place ? 0 : chunk);
+    std::vector<Result> results(chunk);
+    std::vector<ReturnCode> rtns(chunk);
+    std::vector<char> out_buffer(8 * chunk);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t begin = 0; begin < n; begin += chunk) {
+        const std::size_t m = std::min(chunk, n - begin);
+
+        const double *in[BINARY_INPUT_DOUBLE_COLUMNS];
+        const int *pol;
+        if (in_place) {
+            for (std::size_t c = 0; c < BINARY_INPUT_DOUBLE_COLUMNS; c++)
+                in[c] = reinterpret_cast<const double *>(
+                    double_columns + (c * n + begin) * 8
+                );
+            pol = reinterpret_cast<const int *>(pol_column + begin * 4);
+        } else {
+            for (std::size_t c = 0; c < BINARY_INPUT_DOUBLE_COLUMNS; c++) {
+                double *column = decoded.data() + c * chunk;
+                for (std::size_t i = 0; i < m; i++)
+                    column[i] = LoadDouble(
+                        double_columns + (c * n + begin + i) * 8
+                    );
+                in[c] = column;
+            }
+            for (std::size_t i = 0; i < m; i++)
+                decoded_pol[i] = LoadInt32(pol_column + (begin + i) * 4);
+            pol = decoded_pol.data();
+        }
+
+        // The library keeps one pool for each thread count, so the threads
+        // are started by the first chunk and reused by the rest
+        LFMFBatchParallel(
+            m,
+            in[0],
+            in[1],
+            in[2],
+            in[3],
+            in[4],
+            in[5],
+            in[6],
+            in[7],
+            pol,
+            results.data(),
+            rtns.data(),
+            params.n_threads,
+            0
+        );
+
+        // Write this chunk of each output column in its place
+        for (std::size_t c = 0; c < BINARY_OUTPUT_DOUBLE_COLUMNS; c++) {
+            for (std::size_t i = 0; i < m; i++) {
+                double value = nan;
+                if (rtns[i] == SUCCESS) {
+                    value = c == 0   ? results[i].A_btl__db
+                          : c == 1 ? results[i].E_dBuVm
+                                   : results[i].P_rx__dbm;
+                }
+                StoreDouble(value, &out_buffer[8 * i]);
+            }
+            fp.seekp(out_offsets[c] + static_cast<std::streamoff>(8 * begin));
+            fp.write(out_buffer.data(), 8 * m);
+        }
+        for (std::size_t i = 0; i < m; i++) {
+            const int method = rtns[i] == SUCCESS
+                                 ? static_cast<int>(results[i].method)
+                                 : -1;
+            StoreInt32(method, &out_buffer[4 * i]);
+        }
+        fp.seekp(
+            out_offsets[BINARY_OUTPUT_DOUBLE_COLUMNS]
+            + static_cast<std::streamoff>(4 * begin)
+        );
+        fp.write(out_buffer.data(), 4 * m);
+        for (std::size_t i = 0; i < m; i++) {
+            StoreInt32(static_cast<int>(rtns[i]), &out_buffer[4 * i]);
+        }
+        fp.seekp(
+            out_offsets[BINARY_OUTPUT_DOUBLE_COLUMNS + 1]
+            + static_cast<std::streamoff>(4 * begin)
+        );
+        fp.write(out_buffer.data(), 4 * m);
+
+        // A failed write, such as to a full disk, sets the stream state
+        if (!fp) {
+            std::cerr << "Error writing output file. Exiting." << std::endl;
+            return DRVRERR__WRITING_OUTPUT_FILE;
+        }
+    }
+
+    fp.close();
+    if (!fp) {
+        std::cerr << "Error writing output file. Exiting." << std::endl;
+        return DRVRERR__WRITING_OUTPUT_FILE;
+    }
+    return DRVR__SUCCESS;
+}
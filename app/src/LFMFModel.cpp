@@ -4,10 +4,13 @@
 #include "Driver.h"
 
 #include <fstream>   // for std::ifstream, std::ofstream
+#include <iomanip>   // for std::setprecision
+#include <ios>       // for std::ios
 #include <iostream>  // for std::cerr
 #include <istream>   // for std::istream
-#include <ostream>   // for std::endl
-#include <string>    // for std::string
+#include <ostream>   // for std::endl, std::ostream
+#include <sstream>   // for std::istringstream
+#include <string>    // for std::getline, std::string
 #include <tuple>     // for std::tie
 #include <vector>    // for std::vector
 
@@ -47,6 +50,64 @@ ReturnCode CallLFMFModel(LFMFParams &lfmf_params, Result &result) {
     return rtn;
 }
 
+/*******************************************************************************
+ * Parse one LFMF input parameter value into the LFMF parameter struct.
+ * 
+ * @param[in]     key          Lowercase parameter name, one of `LFMFInputKeys`
+ * @param[in]     value        Parameter value as a string
+ * @param[in,out] lfmf_params  LFMF input parameter struct
+ * @return                     Return code; `DRVRERR__PARSE` for an unknown key
+ ******************************************************************************/
+DrvrReturnCode ParseLFMFValue(
+    const std::string &key, const std::string &value, LFMFParams &lfmf_params
+) {
+    DrvrReturnCode rtn;
+    if (key.compare(LFMFInputKeys::h_tx__meter) == 0) {
+        rtn = ParseDouble(value, lfmf_params.h_tx__meter);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_TX_TERMINAL_HEIGHT;
+    } else if (key.compare(LFMFInputKeys::h_rx__meter) == 0) {
+        rtn = ParseDouble(value, lfmf_params.h_rx__meter);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_RX_TERMINAL_HEIGHT;
+    } else if (key.compare(LFMFInputKeys::f__mhz) == 0) {
+        rtn = ParseDouble(value, lfmf_params.f__mhz);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_FREQUENCY;
+    } else if (key.compare(LFMFInputKeys::P_tx__watt) == 0) {
+        rtn = ParseDouble(value, lfmf_params.P_tx__watt);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_TX_POWER;
+    } else if (key.compare(LFMFInputKeys::N_s) == 0) {
+        rtn = ParseDouble(value, lfmf_params.N_s);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_SURFACE_REFRACTIVITY;
+    } else if (key.compare(LFMFInputKeys::d__km) == 0) {
+        rtn = ParseDouble(value, lfmf_params.d__km);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_PATH_DISTANCE;
+    } else if (key.compare(LFMFInputKeys::epsilon) == 0) {
+        rtn = ParseDouble(value, lfmf_params.epsilon);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_EPSILON;
+    } else if (key.compare(LFMFInputKeys::sigma) == 0) {
+        rtn = ParseDouble(value, lfmf_params.sigma);
+        if (rtn == DRVRERR__PARSE)
+            rtn = DRVRERR__PARSE_SIGMA;
+    } else if (key.compare(LFMFInputKeys::pol) == 0) {
+        int pol_int;
+        rtn = ParseInteger(value, pol_int);
+        if (rtn == DRVRERR__PARSE) {
+            rtn = DRVRERR__PARSE_POLARIZATION;
+        } else {
+            lfmf_params.pol = static_cast<Polarization>(pol_int);
+        }
+    } else {
+        rtn = DRVRERR__PARSE;
+    }
+    return rtn;
+}
+
 /*******************************************************************************
  * Parse input stream (file or string stream) to LFMF parameter struct.
  * 
@@ -61,50 +122,9 @@ DrvrReturnCode
     std::string key, value, errMsg;
     while (it) {
         std::tie(key, value) = *it;
-        if (key.compare(LFMFInputKeys::h_tx__meter) == 0) {
-            rtn = ParseDouble(value, lfmf_params.h_tx__meter);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_TX_TERMINAL_HEIGHT;
-        } else if (key.compare(LFMFInputKeys::h_rx__meter) == 0) {
-            rtn = ParseDouble(value, lfmf_params.h_rx__meter);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_RX_TERMINAL_HEIGHT;
-        } else if (key.compare(LFMFInputKeys::f__mhz) == 0) {
-            rtn = ParseDouble(value, lfmf_params.f__mhz);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_FREQUENCY;
-        } else if (key.compare(LFMFInputKeys::P_tx__watt) == 0) {
-            rtn = ParseDouble(value, lfmf_params.P_tx__watt);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_TX_POWER;
-        } else if (key.compare(LFMFInputKeys::N_s) == 0) {
-            rtn = ParseDouble(value, lfmf_params.N_s);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_SURFACE_REFRACTIVITY;
-        } else if (key.compare(LFMFInputKeys::d__km) == 0) {
-            rtn = ParseDouble(value, lfmf_params.d__km);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_PATH_DISTANCE;
-        } else if (key.compare(LFMFInputKeys::epsilon) == 0) {
-            rtn = ParseDouble(value, lfmf_params.epsilon);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_EPSILON;
-        } else if (key.compare(LFMFInputKeys::sigma) == 0) {
-            rtn = ParseDouble(value, lfmf_params.sigma);
-            if (rtn == DRVRERR__PARSE)
-                rtn = DRVRERR__PARSE_SIGMA;
-        } else if (key.compare(LFMFInputKeys::pol) == 0) {
-            int pol_int;
-            rtn = ParseInteger(value, pol_int);
-            if (rtn == DRVRERR__PARSE) {
-                rtn = DRVRERR__PARSE_POLARIZATION;
-            } else {
-                lfmf_params.pol = static_cast<Polarization>(pol_int);
-            }
-        } else {
+        rtn = ParseLFMFValue(key, value, lfmf_params);
+        if (rtn == DRVRERR__PARSE)
             std::cerr << "Unknown parameter: " << key << std::endl;
-            rtn = DRVRERR__PARSE;
-        }
 
         if (rtn != DRVR__SUCCESS) {
             std::cerr << GetDrvrReturnStatusMsg(rtn) << std::endl;
@@ -132,6 +152,41 @@ DrvrReturnCode
     return ParseLFMFInputStream(file, lfmf_params);
 }
 
+/*******************************************************************************
+ * Read the next scenario of a batch input stream.
+ *
+ * A batch input stream holds one or more scenarios, each in the format of a
+ * single LFMF input file and separated from the next by one or more empty
+ * lines. Parameters missing from a scenario are set to zero. A parsing error
+ * is stored in `scenario.parse_rtn` and does not stop the batch.
+ *
+ * @param[in]  stream    Batch input stream
+ * @param[out] scenario  Scenario with its parsed inputs and parsing return code
+ * @return               False if the end of the stream was reached before
+ *                       another scenario was found
+ ******************************************************************************/
+bool ReadLFMFInputBlock(std::istream &stream, BatchScenario &scenario) {
+    std::string block, line;
+    while (std::getline(stream, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty()) {
+            if (block.empty())
+                continue;  // Skip separators between scenarios
+            break;
+        }
+        block += line;
+        block += '\n';
+    }
+    if (block.empty())
+        return false;
+
+    std::istringstream block_stream(block);
+    scenario.params = LFMFParams{};
+    scenario.parse_rtn = ParseLFMFInputStream(block_stream, scenario.params);
+    return true;
+}
+
 /*******************************************************************************
  * Write LFMF Model inputs to the report file
  * 
@@ -167,4 +222,67 @@ void WriteLFMFOutputs(std::ofstream &fp, const Result &result) {
     fp PRINT "Solution method" SETW13 std::fixed
         << std::setprecision(0) << static_cast<int>(result.method)
         << "[0 = Flat earth with curve correction, 1 = Residue series]";
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+ * Write the inputs and results of one batch scenario to the report file
+ * 
+ * @param[in] fp        Output stream, a text file open for writing
+ * @param[in] scenario  Evaluated batch scenario
+ ******************************************************************************/
+void WriteLFMFScenario(std::ofstream &fp, const BatchScenario &scenario) {
+    // Undo the fixed-point formatting left by the previous scenario's outputs
+    fp.unsetf(std::ios::floatfield);
+    fp << std::setprecision(6);
+
+    fp << std::endl << std::endl << "Scenario " << scenario.index + 1 << ":";
+    if (scenario.parse_rtn != DRVR__SUCCESS) {
+        fp PRINT "Return Code" SETW13 scenario.parse_rtn;
+        PrintLabel(fp, GetDrvrReturnStatusMsg(scenario.parse_rtn));
+        return;
+    }
+
+    fp << std::endl << "Inputs:";
+    WriteLFMFInputs(fp, scenario.params);
+    fp << std::endl << "Results:";
+    fp PRINT "Return Code" SETW13 scenario.rtn;
+    PrintLabel(fp, GetReturnStatus(scenario.rtn));
+    if (scenario.rtn == SUCCESS) {
+        WriteLFMFOutputs(fp, scenario.result);
+    }
+}
+
+/*******************************************************************************
+ * Write the column names of the CSV batch output
+ * 
+ * @param[in] os  Output stream for writing
+ ******************************************************************************/
+void WriteLFMFCsvHeader(std::ostream &os) {
+    os << "row,rtn,A_btl__db,E_dBuVm,P_rx__dbm,method\n";
+}
+
+/*******************************************************************************
+ * Write one batch scenario as a row of the CSV batch output
+ * 
+ * The row number counts scenarios from 1, in input order. The results are left
+ * empty unless the return code is `SUCCESS`; for a parsing error, the return
+ * code is the driver return code.
+ * 
+ * @param[in] os        Output stream for writing
+ * @param[in] scenario  Evaluated batch scenario
+ ******************************************************************************/
+void WriteLFMFCsvRow(std::ostream &os, const BatchScenario &scenario) {
+    const int rtn = scenario.parse_rtn != DRVR__SUCCESS
+                      ? static_cast<int>(scenario.parse_rtn)
+                      : static_cast<int>(scenario.rtn);
+    os << scenario.index + 1 << ',' << rtn;
+    if (rtn == SUCCESS) {
+        os << ',' << std::fixed << std::setprecision(2)
+           << scenario.result.A_btl__db << ',' << scenario.result.E_dBuVm
+           << ',' << scenario.result.P_rx__dbm << ','
+           << static_cast<int>(scenario.result.method);
+    } else {
+        os << ",,,,";
+    }
+    os << '\n';
+}
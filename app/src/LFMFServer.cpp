@@ -0,0 +1,360 @@
+/** @file LFMFServer.cpp
+ * Implements a long-running server mode which answers LF/MF Propagation Model
+ * requests over standard input or a Unix domain socket.
+ */
+#include "Driver.h"
+
+#ifdef _WIN32
+    #include <io.h>  // for _read, _write
+#else                // macOS and Linux
+    #include <cerrno>        // for errno, EINTR, ECONNABORTED, ENOENT, ...
+    #include <csignal>       // for std::signal, SIGPIPE, SIG_IGN
+    #include <sys/socket.h>  // for accept, bind, listen, socket
+    #include <sys/stat.h>    // for lstat, S_ISSOCK
+    #include <sys/un.h>      // for sockaddr_un
+    #include <unistd.h>      // for close, read, unlink, write
+#endif
+
+#include <algorithm>           // for std::min
+#include <chrono>              // for std::chrono::milliseconds
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <cstring>             // for std::memchr, std::memmove, std::memset
+#include <iostream>            // for std::cerr
+#include <memory>              // for std::make_shared, std::shared_ptr
+#include <mutex>               // for std::lock_guard, std::unique_lock
+#include <ostream>             // for std::endl
+#include <sstream>             // for std::ostringstream
+#include <string>              // for std::string
+#include <system_error>        // for std::system_error
+#include <thread>              // for std::thread, std::this_thread
+#include <vector>              // for std::vector
+
+/** Capacity of the residue series root cache kept warm by the server */
+constexpr std::size_t SERVER_ROOT_CACHE_CAPACITY = 1024;
+
+/** Initial size of the buffer of each connection, in bytes */
+constexpr std::size_t SERVER_BUFFER_SIZE = 65536;
+
+/** Longest request line, in bytes; a client sending a longer one is dropped */
+constexpr std::size_t SERVER_MAX_REQUEST_SIZE = 1048576;
+
+/** Number of clients served at once; further connections wait to be accepted */
+constexpr unsigned int SERVER_MAX_CLIENTS = 64;
+
+/** Wait before accepting again when the process is out of resources */
+constexpr std::chrono::milliseconds SERVER_ACCEPT_BACKOFF(100);
+
+namespace {
+
+/** Read from a file descriptor; returns the number of bytes, 0 at the end,
+ *  or -1 on failure. A read interrupted by a signal is retried. */
+long ReadFd(const int fd, char *buffer, const std::size_t size) {
+#ifdef _WIN32
+    return _read(fd, buffer, static_cast<unsigned int>(size));
+#else
+    long n;
+    do {
+        n = static_cast<long>(read(fd, buffer, size));
+    } while (n == -1 && errno == EINTR);
+    return n;
+#endif
+}
+
+/** Write all of `data` to a file descriptor; returns false on failure */
+bool WriteFd(const int fd, const std::string &data) {
+    std::size_t done = 0;
+    while (done < data.size()) {
+#ifdef _WIN32
+        const long n = _write(
+            fd,
+            data.data() + done,
+            static_cast<unsigned int>(data.size() - done)
+        );
+#else
+        const long n = static_cast<long>(
+            write(fd, data.data() + done, data.size() - done)
+        );
+        if (n == -1 && errno == EINTR)
+            continue;
+#endif
+        if (n <= 0)
+            return false;
+        done += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Parse one request line into a scenario.
+ *
+ * A request holds the values of the `LFMFInputKeys`, comma-separated, in the
+ * order in which `LFMFParams` declares them.
+ *
+ * @param[in]  first     Start of the request line
+ * @param[in]  last      End of the request line, without its line ending
+ * @param[out] scenario  Scenario with its parsed inputs and return code
+ ******************************************************************************/
+void ParseRequest(
+    const char *first, const char *last, BatchScenario &scenario
+) {
+    static const std::string *const keys[] = {
+        &LFMFInputKeys::h_tx__meter,
+        &LFMFInputKeys::h_rx__meter,
+        &LFMFInputKeys::f__mhz,
+        &LFMFInputKeys::P_tx__watt,
+        &LFMFInputKeys::N_s,
+        &LFMFInputKeys::d__km,
+        &LFMFInputKeys::epsilon,
+        &LFMFInputKeys::sigma,
+        &LFMFInputKeys::pol
+    };
+    const std::size_t n_keys = sizeof(keys) / sizeof(keys[0]);
+
+    scenario.params = LFMFParams{};
+    scenario.parse_rtn = DRVR__SUCCESS;
+    std::string value;
+    const char *field = first;
+    bool line_ended = false;
+    for (std::size_t k = 0; k < n_keys; k++) {
+        if (line_ended) {
+            scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+            return;
+        }
+        const void *comma = std::memchr(field, ',', last - field);
+        const char *field_end
+            = comma != nullptr ? static_cast<const char *>(comma) : last;
+        value.assign(field, field_end);
+        scenario.parse_rtn = ParseLFMFValue(*keys[k], value, scenario.params);
+        if (scenario.parse_rtn != DRVR__SUCCESS)
+            return;
+        if (field_end == last)
+            line_ended = true;
+        else
+            field = field_end + 1;
+    }
+    if (!line_ended)
+        scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+}
+
+/*******************************************************************************
+ * Answer the requests of one client until it closes its input.
+ *
+ * Requests are answered one at a time, in the order they were received. Every
+ * request which is already buffered is answered before the replies are
+ * written, so a client may send many requests without waiting.
+ *
+ * A request longer than `SERVER_MAX_REQUEST_SIZE` is answered with
+ * `DRVRERR__PARSE_CSV_ROW`, and the connection is then dropped.
+ *
+ * @param[in] in_fd   File descriptor the requests are read from
+ * @param[in] out_fd  File descriptor the replies are written to
+ ******************************************************************************/
+void ServeConnection(const int in_fd, const int out_fd) {
+    std::vector<char> buffer(SERVER_BUFFER_SIZE);
+    std::size_t begin = 0;  // Start of the first unanswered request
+    std::size_t end = 0;    // End of the received bytes
+    std::size_t n_requests = 0;
+    BatchScenario scenario;
+    std::ostringstream reply;
+
+    bool open = true;
+    while (open) {
+        if (end == buffer.size()) {
+            if (begin > 0) {
+                std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+                end -= begin;
+                begin = 0;
+            } else if (buffer.size() < SERVER_MAX_REQUEST_SIZE) {
+                // A very long request
+                buffer.resize(
+                    std::min(2 * buffer.size(), SERVER_MAX_REQUEST_SIZE)
+                );
+            } else {
+                // Too long a request, or one without a line ending
+                scenario.params = LFMFParams{};
+                scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+                scenario.index = n_requests;
+                WriteLFMFCsvRow(reply, scenario);
+                WriteFd(out_fd, reply.str());
+                return;
+            }
+        }
+        const long n = ReadFd(in_fd, buffer.data() + end, buffer.size() - end);
+        if (n > 0) {
+            end += static_cast<std::size_t>(n);
+        } else {
+            // Answer a last request which has no line ending
+            open = false;
+            if (begin < end && buffer[end - 1] != '\n') {
+                if (end == buffer.size())
+                    buffer.resize(buffer.size() + 1);
+                buffer[end++] = '\n';
+            }
+        }
+
+        while (begin < end) {
+            char *first = buffer.data() + begin;
+            char *newline
+                = static_cast<char *>(std::memchr(first, '\n', end - begin));
+            if (newline == nullptr)
+                break;
+            begin = static_cast<std::size_t>(newline - buffer.data()) + 1;
+
+            char *last = newline;
+            if (last > first && last[-1] == '\r')
+                last--;
+            if (last == first)
+                continue;  // Skip empty lines
+
+            ParseRequest(first, last, scenario);
+            scenario.index = n_requests++;
+            if (scenario.parse_rtn == DRVR__SUCCESS)
+                scenario.rtn = CallLFMFModel(scenario.params, scenario.result);
+            WriteLFMFCsvRow(reply, scenario);
+        }
+
+        if (reply.tellp() > 0) {
+            if (!WriteFd(out_fd, reply.str()))
+                return;  // The client went away
+            reply.str("");
+        }
+    }
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Run the driver as a server which answers requests until its input ends.
+ *
+ * Each request is a line holding the values of the `LFMFInputKeys`,
+ * comma-separated, in the order in which `LFMFParams` declares them. Each
+ * reply is a line in the format of a CSV batch output row; its row number
+ * counts the requests of the connection from 1. Replies are sent in request
+ * order.
+ *
+ * Requests are read from standard input, with replies on standard output,
+ * unless a Unix domain socket path was given. In that case, the server accepts
+ * connections on the socket forever and answers each on its own thread, with
+ * at most `SERVER_MAX_CLIENTS` clients served at once. A file already at the
+ * socket path is replaced only if it is a socket.
+ *
+ * The process stays running between requests, so state such as the residue
+ * series root cache stays warm.
+ *
+ * @param[in] params  Structure with user input parameters
+ * @return            Return code
+ ******************************************************************************/
+DrvrReturnCode RunServer(const DrvrParams &params) {
+    SetRootCacheCapacity(SERVER_ROOT_CACHE_CAPACITY);
+
+    if (params.socket_path.empty()) {
+        ServeConnection(0, 1);
+        return DRVR__SUCCESS;
+    }
+
+#ifdef _WIN32
+    std::cerr << "Unix domain sockets are not supported on this platform"
+              << std::endl;
+    return DRVRERR__SERVER_SOCKET;
+#else
+    // Writing to a client which went away must not end the server
+    std::signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (params.socket_path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Socket path is too long: " << params.socket_path
+                  << std::endl;
+        return DRVRERR__SERVER_SOCKET;
+    }
+    params.socket_path.copy(address.sun_path, params.socket_path.size());
+
+    // Remove a socket left by a past run, but never any other kind of file
+    struct stat status;
+    if (lstat(params.socket_path.c_str(), &status) == 0) {
+        if (!S_ISSOCK(status.st_mode)) {
+            std::cerr << "Socket path exists and is not a socket: "
+                      << params.socket_path << std::endl;
+            return DRVRERR__SERVER_SOCKET;
+        }
+        unlink(params.socket_path.c_str());
+    } else if (errno != ENOENT) {
+        std::cerr << GetDrvrReturnStatusMsg(DRVRERR__SERVER_SOCKET) << ": "
+                  << params.socket_path << std::endl;
+        return DRVRERR__SERVER_SOCKET;
+    }
+
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == -1) {
+        std::cerr << GetDrvrReturnStatusMsg(DRVRERR__SERVER_SOCKET)
+                  << std::endl;
+        return DRVRERR__SERVER_SOCKET;
+    }
+    if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address))
+            != 0
+        || listen(listener, SOMAXCONN) != 0) {
+        std::cerr << GetDrvrReturnStatusMsg(DRVRERR__SERVER_SOCKET) << ": "
+                  << params.socket_path << std::endl;
+        close(listener);
+        return DRVRERR__SERVER_SOCKET;
+    }
+
+    // Number of clients being served, shared with the detached client threads
+    struct Clients {
+            std::mutex mutex;
+            std::condition_variable done_cv;
+            unsigned int active = 0;
+    };
+    const std::shared_ptr<Clients> clients = std::make_shared<Clients>();
+
+    while (true) {
+        // Leave further connections queued until a client finishes
+        {
+            std::unique_lock<std::mutex> lock(clients->mutex);
+            clients->done_cv.wait(lock, [&]() {
+                return clients->active < SERVER_MAX_CLIENTS;
+            });
+        }
+
+        const int client = accept(listener, nullptr, nullptr);
+        if (client == -1) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS
+                || errno == ENOMEM) {
+                // Out of descriptors or memory until a client finishes
+                std::this_thread::sleep_for(SERVER_ACCEPT_BACKOFF);
+                continue;
+            }
+            std::cerr << GetDrvrReturnStatusMsg(DRVRERR__SERVER_SOCKET) << ": "
+                      << params.socket_path << std::endl;
+            close(listener);
+            return DRVRERR__SERVER_SOCKET;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(clients->mutex);
+            clients->active++;
+        }
+        try {
+            std::thread([client, clients] {
+                ServeConnection(client, client);
+                close(client);
+                std::lock_guard<std::mutex> lock(clients->mutex);
+                clients->active--;
+                clients->done_cv.notify_one();
+            }).detach();
+        } catch (const std::system_error &) {
+            // Out of threads until a client finishes
+            close(client);
+            {
+                std::lock_guard<std::mutex> lock(clients->mutex);
+                clients->active--;
+            }
+            std::this_thread::sleep_for(SERVER_ACCEPT_BACKOFF);
+        }
+    }
+#endif
+}
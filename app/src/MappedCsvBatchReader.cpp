@@ -0,0 +1,239 @@
+/** @file MappedCsvBatchReader.cpp
+ * Implementation of class to scan CSV batch input in place.
+ */
+#include "MappedCsvBatchReader.h"
+
+#include "Driver.h"
+
+#include <cstddef>   // for std::size_t
+#include <cstring>   // for std::memchr
+#include <iostream>  // for std::cerr
+#include <ostream>   // for std::endl
+#include <string>    // for std::string
+#include <vector>    // for std::vector
+
+namespace {
+
+/** Number of LFMF input parameters, and so of CSV columns */
+constexpr int N_PARAMS = 9;
+
+/** Index of the polarization parameter, the only integer one */
+constexpr int POL_PARAM = 8;
+
+/** Input key of each parameter */
+const std::string *const PARAM_KEYS[N_PARAMS] = {
+    &LFMFInputKeys::h_tx__meter,
+    &LFMFInputKeys::h_rx__meter,
+    &LFMFInputKeys::f__mhz,
+    &LFMFInputKeys::P_tx__watt,
+    &LFMFInputKeys::N_s,
+    &LFMFInputKeys::d__km,
+    &LFMFInputKeys::epsilon,
+    &LFMFInputKeys::sigma,
+    &LFMFInputKeys::pol
+};
+
+/** Member holding each floating point parameter */
+double LFMFParams::*const PARAM_MEMBERS[POL_PARAM] = {
+    &LFMFParams::h_tx__meter,
+    &LFMFParams::h_rx__meter,
+    &LFMFParams::f__mhz,
+    &LFMFParams::P_tx__watt,
+    &LFMFParams::N_s,
+    &LFMFParams::d__km,
+    &LFMFParams::epsilon,
+    &LFMFParams::sigma
+};
+
+/** Return code for a failure to parse each parameter */
+const DrvrReturnCode PARAM_ERRORS[N_PARAMS] = {
+    DRVRERR__PARSE_TX_TERMINAL_HEIGHT,
+    DRVRERR__PARSE_RX_TERMINAL_HEIGHT,
+    DRVRERR__PARSE_FREQUENCY,
+    DRVRERR__PARSE_TX_POWER,
+    DRVRERR__PARSE_SURFACE_REFRACTIVITY,
+    DRVRERR__PARSE_PATH_DISTANCE,
+    DRVRERR__PARSE_EPSILON,
+    DRVRERR__PARSE_SIGMA,
+    DRVRERR__PARSE_POLARIZATION
+};
+
+/*******************************************************************************
+ * Find the end of the field which starts at `first`.
+ *
+ * @param[in] first  Start of the field
+ * @param[in] last   End of the line
+ * @return           Position of the comma ending the field, or `last`
+ ******************************************************************************/
+const char *FieldEnd(const char *first, const char *last) {
+    const void *comma = std::memchr(first, ',', last - first);
+    return comma != nullptr ? static_cast<const char *>(comma) : last;
+}
+
+/*******************************************************************************
+ * Remove spaces and tabs from both ends of the range [first, last).
+ *
+ * @param[in, out] first  Start of the range
+ * @param[in, out] last   End of the range
+ ******************************************************************************/
+void Trim(const char *&first, const char *&last) {
+    while (first < last && (*first == ' ' || *first == '\t'))
+        first++;
+    while (last > first && (last[-1] == ' ' || last[-1] == '\t'))
+        last--;
+}
+
+}  // namespace
+
+MappedCsvBatchReader::MappedCsvBatchReader(
+    const char *data, const std::size_t size
+):
+    pos_(data), end_(data + size), line_start_(data) {}
+
+/***********************************************************************
+ * Find the next non-empty line, without its line ending.
+ *
+ * @param[out] first  Start of the line
+ * @param[out] last   End of the line
+ * @return            False if the end of the contents was reached
+ **********************************************************************/
+bool MappedCsvBatchReader::NextLine(const char *&first, const char *&last) {
+    while (pos_ < end_) {
+        first = pos_;
+        const void *newline = std::memchr(pos_, '\n', end_ - pos_);
+        last = newline != nullptr ? static_cast<const char *>(newline) : end_;
+        pos_ = last < end_ ? last + 1 : end_;
+        line_++;
+
+        if (last > first && last[-1] == '\r')
+            last--;
+        if (last > first) {
+            line_start_ = first;
+            return true;
+        }
+    }
+    return false;
+}
+
+/***********************************************************************
+ * Print a parsing error with its position in the input.
+ *
+ * @param[in] rtn     Driver return code of the error
+ * @param[in] at      Position of the error on the current line
+ * @param[in] column  CSV column of the error, from 0; -1 for none
+ **********************************************************************/
+void MappedCsvBatchReader::ReportError(
+    const DrvrReturnCode rtn, const char *at, const int column
+) const {
+    std::cerr << "Line " << line_ << ", column " << (at - line_start_) + 1;
+    if (column >= 0 && column < static_cast<int>(columns_.size()))
+        std::cerr << " (" << *PARAM_KEYS[columns_[column]] << ")";
+    std::cerr << ": " << GetDrvrReturnStatusMsg(rtn) << std::endl;
+}
+
+/***********************************************************************
+ * Read and validate the header line.
+ *
+ * @return Return code; `DRVRERR__PARSE_CSV_HEADER` if a column is not one
+ *         of the `LFMFInputKeys`, or any of them is repeated or missing
+ **********************************************************************/
+DrvrReturnCode MappedCsvBatchReader::ReadHeader() {
+    columns_.clear();
+    const char *first, *last;
+    if (!NextLine(first, last)) {
+        ReportError(DRVRERR__PARSE_CSV_HEADER, line_start_, -1);
+        return DRVRERR__PARSE_CSV_HEADER;
+    }
+
+    bool seen[N_PARAMS] = {false};
+    const char *field = first;
+    while (true) {
+        const char *field_end = FieldEnd(field, last);
+        const char *name_first = field;
+        const char *name_last = field_end;
+        Trim(name_first, name_last);
+        std::string name(name_first, name_last);
+        StringToLower(name);
+
+        int param = 0;
+        while (param < N_PARAMS && name != *PARAM_KEYS[param])
+            param++;
+        if (param == N_PARAMS || seen[param]) {
+            ReportError(DRVRERR__PARSE_CSV_HEADER, name_first, -1);
+            return DRVRERR__PARSE_CSV_HEADER;
+        }
+        seen[param] = true;
+        columns_.push_back(param);
+
+        if (field_end == last)
+            break;
+        field = field_end + 1;
+    }
+
+    if (columns_.size() != N_PARAMS) {
+        ReportError(DRVRERR__PARSE_CSV_HEADER, last, -1);
+        return DRVRERR__PARSE_CSV_HEADER;
+    }
+    return DRVR__SUCCESS;
+}
+
+/***********************************************************************
+ * Read the next row as a scenario.
+ *
+ * Parsing errors are stored in `scenario.parse_rtn` and do not stop the
+ * batch.
+ *
+ * @param[out] scenario  Scenario with its parsed inputs and return code
+ * @return               False if the end of the contents was reached
+ **********************************************************************/
+bool MappedCsvBatchReader::Read(BatchScenario &scenario) {
+    const char *first, *last;
+    if (!NextLine(first, last))
+        return false;
+
+    scenario.params = LFMFParams{};
+    scenario.parse_rtn = DRVR__SUCCESS;
+
+    const char *field = first;
+    bool line_ended = false;
+    for (int column = 0; column < N_PARAMS; column++) {
+        if (line_ended) {
+            // The previous field ended the line, so this column is missing
+            scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+            ReportError(scenario.parse_rtn, last, column);
+            return true;
+        }
+        const char *field_end = FieldEnd(field, last);
+        const char *value_first = field;
+        const char *value_last = field_end;
+        Trim(value_first, value_last);
+
+        const int param = columns_[column];
+        DrvrReturnCode rtn;
+        if (param == POL_PARAM) {
+            int pol_int = 0;
+            rtn = ParseInteger(value_first, value_last, pol_int);
+            scenario.params.pol = static_cast<Polarization>(pol_int);
+        } else {
+            rtn = ParseDouble(
+                value_first, value_last, scenario.params.*PARAM_MEMBERS[param]
+            );
+        }
+        if (rtn != DRVR__SUCCESS) {
+            scenario.parse_rtn = PARAM_ERRORS[param];
+            ReportError(scenario.parse_rtn, value_first, column);
+            return true;
+        }
+        if (field_end == last)
+            line_ended = true;
+        else
+            field = field_end + 1;
+    }
+
+    if (!line_ended) {
+        // Text remains after the last column
+        scenario.parse_rtn = DRVRERR__PARSE_CSV_ROW;
+        ReportError(scenario.parse_rtn, field - 1, -1);
+    }
+    return true;
+}
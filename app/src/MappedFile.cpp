@@ -0,0 +1,107 @@
+/** @file MappedFile.cpp
+ * Implementation of class for memory-mapped access to input files.
+ */
+#include "MappedFile.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>  // for CreateFileA, CreateFileMappingA, MapViewOfFile
+#else                     // macOS and Linux
+    #include <fcntl.h>     // for open, O_RDONLY
+    #include <sys/mman.h>  // for madvise, mmap, munmap
+    #include <sys/stat.h>  // for fstat, S_ISREG
+    #include <unistd.h>    // for close
+#endif
+
+#include <cstddef>  // for std::size_t
+#include <string>   // for std::string
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string &path) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    file_ = file;
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_ == 0)
+        return true;  // Empty files cannot be mapped, and need not be
+
+    mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ == nullptr) {
+        Close();
+        return false;
+    }
+    data_ = static_cast<const char *>(
+        MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)
+    );
+    if (data_ == nullptr) {
+        Close();
+        return false;
+    }
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ == 0) {
+        close(fd);
+        return true;  // Empty files cannot be mapped, and need not be
+    }
+
+    void *addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid after the file is closed
+    if (addr == MAP_FAILED) {
+        size_ = 0;
+        return false;
+    }
+    madvise(addr, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char *>(addr);
+#endif
+    return true;
+}
+
+/***********************************************************************
+ * Release the mapping, if any.
+ **********************************************************************/
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data_ != nullptr)
+        UnmapViewOfFile(data_);
+    if (mapping_ != nullptr)
+        CloseHandle(mapping_);
+    if (file_ != nullptr)
+        CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    if (data_ != nullptr)
+        munmap(const_cast<char *>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
@@ -23,6 +23,11 @@ std::string GetDrvrReturnStatusMsg(int code) {
             "Failed to open the input file for reading"},
            {DRVRERR__OPENING_OUTPUT_FILE,
             "Failed to open the output file for writing"},
+           {DRVRERR__INVALID_THREAD_COUNT,
+            "Thread count is not a non-negative integer"},
+           {DRVRERR__SERVER_SOCKET, "Failed to set up the server socket"},
+           {DRVRERR__WRITING_OUTPUT_FILE, "Failed to write the output file"},
+           {DRVRERR__BATCH_THREAD, "A batch thread failed to start or to run"},
            {DRVRERR__PARSE, "Failed parsing inputs; unknown parameter"},
            {DRVRERR__PARSE_TX_TERMINAL_HEIGHT,
             "Failed to parse TX terminal height value"},
@@ -35,7 +40,12 @@ std::string GetDrvrReturnStatusMsg(int code) {
            {DRVRERR__PARSE_PATH_DISTANCE, "Failed to parse path distance value"           },
            {DRVRERR__PARSE_EPSILON, "Failed to parse epsilon value"},
            {DRVRERR__PARSE_SIGMA, "Failed to parse sigma value"},
-           {DRVRERR__PARSE_POLARIZATION, "Failed to parse polarization value"},  
+           {DRVRERR__PARSE_POLARIZATION, "Failed to parse polarization value"},
+           {DRVRERR__PARSE_CSV_HEADER,
+            "CSV header has an unknown, repeated or missing column"},
+           {DRVRERR__PARSE_CSV_ROW, "CSV row has the wrong number of columns"},
+           {DRVRERR__PARSE_BINARY_HEADER,
+            "Binary input has an invalid header or the wrong size"},  
            {DRVRERR__VALIDATION_IN_FILE,
             "Option -i is required but was not provided"},
            {DRVRERR__VALIDATION_OUT_FILE,
@@ -34,8 +34,12 @@ class DriverTest: public ::testing::Test {
          * Sets up the test environment.
          **********************************************************************/
         void SetUp() override {
-            // Set the default driver params
-            params.out_file = "tmp_out.txt";
+            // Set the default driver params, with an output file name unique
+            // to the test, since tests may run in parallel
+            const ::testing::TestInfo *info
+                = ::testing::UnitTest::GetInstance()->current_test_info();
+            params.out_file = std::string("tmp_out_") + info->test_suite_name()
+                            + "_" + info->name() + ".txt";
 
             // Get the name of the executable to test
             executable = std::string(DRIVER_LOCATION);
@@ -0,0 +1,399 @@
+/** @file TestDriverBatch.cpp
+ * Tests for the batch modes of the driver executable
+ */
+#include "TestDriver.h"
+
+#include "BinaryFormat.h"
+
+#include <cmath>     // for std::isnan
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::int32_t, std::uint64_t
+#include <cstring>   // for std::memcpy
+#include <fstream>   // for std::ifstream, std::ofstream
+#include <ios>       // for std::ios
+#include <iterator>  // for std::istreambuf_iterator
+#include <string>    // for std::string, std::to_string
+#include <vector>    // for std::vector
+
+/*******************************************************************************
+ * Driver test fixture for batch mode
+ ******************************************************************************/
+class BatchDriverTest: public DriverTest {
+    protected:
+        /***********************************************************************
+         * Runs the driver in batch mode and reads back its report.
+         *
+         * @param[in]  inputs  Contents of the batch input file
+         * @param[in]  opts    Extra command line options
+         * @param[out] report  Contents of the output file
+         * @return             Return code from the driver execution
+         **********************************************************************/
+        int RunBatch(
+            const std::string &inputs, const std::string &opts, std::string &report
+        ) {
+            TempTextFile tempFile(inputs);
+            std::string cmd = executable + " -b " + opts;
+            cmd += " -i " + tempFile.getFileName() + " -o " + params.out_file;
+            SuppressOutputs(cmd);
+            int rtn = RunCommand(cmd);
+
+            std::ifstream out(params.out_file);
+            report.assign(
+                std::istreambuf_iterator<char>(out),
+                std::istreambuf_iterator<char>()
+            );
+            out.close();
+            DeleteOutputFile(params.out_file);
+            return rtn;
+        }
+
+        /** Returns a scenario whose path distance is `d__km` */
+        std::string Scenario(const double d__km) {
+            return "h_tx__meter,0\nh_rx__meter,0\nf__mhz,0.01\nP_tx__watt,1000"
+                   "\nN_s,301\nd__km,"
+                 + std::to_string(d__km) + "\nepsilon,15\nsigma,0.005\npol,0\n";
+        }
+};
+
+TEST_F(BatchDriverTest, OutputOrderMatchesInputOrder) {
+    const int n = 40;
+    std::string inputs;
+    for (int i = 0; i < n; i++) {
+        // Alternate short and long paths so scenarios finish out of order
+        inputs += Scenario(i % 2 == 0 ? 1.0 + i : 1000.0 + 10 * i) + "\n";
+    }
+
+    std::string report;
+    EXPECT_EQ(RunBatch(inputs, "-t 4", report), SUCCESS);
+
+    std::size_t pos = 0;
+    for (int i = 1; i <= n; i++) {
+        const std::string label = "Scenario " + std::to_string(i) + ":";
+        const std::size_t found = report.find(label, pos);
+        ASSERT_NE(found, std::string::npos) << label;
+        pos = found + label.size();
+    }
+    EXPECT_EQ(report.find("Scenario " + std::to_string(n + 1)), std::string::npos);
+}
+
+TEST_F(BatchDriverTest, ParseErrorDoesNotStopBatch) {
+    const std::string inputs
+        = Scenario(10) + "\n" + "d__km,invalid\n\n" + Scenario(20);
+
+    std::string report;
+    EXPECT_EQ(RunBatch(inputs, "-t 2", report), SUCCESS);
+
+    const std::size_t second = report.find("Scenario 2:");
+    const std::size_t third = report.find("Scenario 3:");
+    ASSERT_NE(second, std::string::npos);
+    ASSERT_NE(third, std::string::npos);
+    const std::string error_code = std::to_string(DRVRERR__PARSE_PATH_DISTANCE);
+    EXPECT_NE(
+        report.substr(second, third - second).find(error_code),
+        std::string::npos
+    );
+    EXPECT_NE(report.find("Basic transmission loss", third), std::string::npos);
+}
+
+TEST_F(BatchDriverTest, InvalidThreadCountError) {
+    std::string report;
+    EXPECT_EQ(
+        RunBatch(Scenario(10), "-t many", report), DRVRERR__INVALID_THREAD_COUNT
+    );
+}
+
+TEST_F(BatchDriverTest, CsvOneRowPerScenario) {
+    std::string inputs = "pol,d__km,h_tx__meter,h_rx__meter,f__mhz,P_tx__watt,"
+                         "N_s,epsilon,sigma\n";
+    const int n = 25;
+    for (int i = 0; i < n; i++) {
+        inputs += "0," + std::to_string(i % 2 == 0 ? 1.0 + i : 1000.0 + 10 * i)
+                + ",0,0,0.01,1000,301,15,0.005\n";
+    }
+    inputs += "0,10,0,0,0.01,1000,301,15\n";  // Missing a column
+
+    std::string report;
+    EXPECT_EQ(RunBatch(inputs, "-csv -t 3", report), SUCCESS);
+
+    std::size_t pos = report.find('\n');
+    ASSERT_NE(pos, std::string::npos);
+    EXPECT_EQ(report.substr(0, pos), "row,rtn,A_btl__db,E_dBuVm,P_rx__dbm,method");
+    for (int i = 1; i <= n; i++) {
+        const std::string row = "\n" + std::to_string(i) + ",0,";
+        EXPECT_EQ(report.compare(pos, row.size(), row), 0) << row;
+        pos = report.find('\n', pos + 1);
+        ASSERT_NE(pos, std::string::npos);
+    }
+    EXPECT_EQ(
+        report.substr(pos),
+        "\n" + std::to_string(n + 1) + ","
+            + std::to_string(DRVRERR__PARSE_CSV_ROW) + ",,,,\n"
+    );
+}
+
+TEST_F(BatchDriverTest, CsvHeaderError) {
+    std::string report;
+    EXPECT_EQ(
+        RunBatch("h_tx__meter,h_rx__meter\n0,0\n", "-csv", report),
+        DRVRERR__PARSE_CSV_HEADER
+    );
+}
+
+TEST_F(BatchDriverTest, CsvParseErrorsAndUnterminatedLastRow) {
+    const std::string inputs
+        = "h_tx__meter,h_rx__meter,f__mhz,p_tx__watt,n_s,d__km,epsilon,sigma,"
+          "pol\r\n"
+          "0,0,0.01,1000,301,10x,15,0.005,0\r\n"
+          "0,0,0.01,1000,301,10,15,0.005,0,7\r\n"
+          "\r\n"
+          "0,0,0.01,1000,301,10,15,0.005,1.5\r\n"
+          "0,0,0.01,1000,301,\v10,15,0.005,0\r\n"
+          "0,0,0.01,1000,301,10,15,0.005,\f0\r\n"
+          " 0 , 0 , 0.01 , 1000 , 301 , 10 , 15 , 0.005 , 0 ";
+
+    std::string report;
+    EXPECT_EQ(RunBatch(inputs, "-csv", report), SUCCESS);
+    EXPECT_NE(
+        report.find("\n1," + std::to_string(DRVRERR__PARSE_PATH_DISTANCE) + ","),
+        std::string::npos
+    );
+    EXPECT_NE(
+        report.find("\n2," + std::to_string(DRVRERR__PARSE_CSV_ROW) + ","),
+        std::string::npos
+    );
+    EXPECT_NE(
+        report.find("\n3," + std::to_string(DRVRERR__PARSE_POLARIZATION) + ","),
+        std::string::npos
+    );
+    EXPECT_NE(
+        report.find("\n4," + std::to_string(DRVRERR__PARSE_PATH_DISTANCE) + ","),
+        std::string::npos
+    );
+    EXPECT_NE(
+        report.find("\n5," + std::to_string(DRVRERR__PARSE_POLARIZATION) + ","),
+        std::string::npos
+    );
+    EXPECT_NE(report.find("\n6,0,"), std::string::npos);
+}
+
+TEST_F(BatchDriverTest, CsvUnterminatedShortLastRow) {
+    const std::string inputs
+        = "h_tx__meter,h_rx__meter,f__mhz,p_tx__watt,n_s,d__km,epsilon,sigma,"
+          "pol\n"
+          "0,0,0.01,1000,301,10,15,0.005,0\n"
+          "0,0,0.01,1000,301,10,15,0.005";
+
+    std::string report;
+    EXPECT_EQ(RunBatch(inputs, "-csv", report), SUCCESS);
+    EXPECT_NE(report.find("\n1,0,"), std::string::npos);
+    EXPECT_NE(
+        report.find("\n2," + std::to_string(DRVRERR__PARSE_CSV_ROW) + ",,,,\n"),
+        std::string::npos
+    );
+}
+
+TEST_F(BatchDriverTest, BinaryColumnsMatchSinglePointCalls) {
+    // Columns of the input file, one scenario per element
+    const std::vector<std::vector<double>> columns = {
+        {0, 0, 0},          // h_tx__meter
+        {0, 10, 0},         // h_rx__meter
+        {0.01, 0.5, 0.01},  // f__mhz
+        {1000, 1000, 1000}, // P_tx__watt
+        {301, 301, 301},    // N_s
+        {10, 1000, -5},     // d__km, the last one invalid
+        {15, 15, 15},       // epsilon
+        {0.005, 0.005, 0.005}  // sigma
+    };
+    const std::vector<std::int32_t> pol = {0, 1, 0};
+    const std::uint64_t n = pol.size();
+
+    // Unique name, since tests may run in parallel
+    const TempTextFile tempFile("");
+    const std::string in_file = tempFile.getFileName();
+    std::ofstream in(in_file, std::ios::binary | std::ios::trunc);
+    in.write(BINARY_INPUT_MAGIC, 8);
+    in.write(reinterpret_cast<const char *>(&n), 8);
+    for (const std::vector<double> &column : columns) {
+        in.write(reinterpret_cast<const char *>(column.data()), 8 * n);
+    }
+    in.write(reinterpret_cast<const char *>(pol.data()), 4 * n);
+    in.close();
+
+    std::string cmd = executable + " -bin -t 2 -i " + in_file + " -o "
+                    + params.out_file;
+    SuppressOutputs(cmd);
+    EXPECT_EQ(RunCommand(cmd), SUCCESS);
+
+    std::ifstream out(params.out_file, std::ios::binary);
+    std::string contents(
+        (std::istreambuf_iterator<char>(out)), std::istreambuf_iterator<char>()
+    );
+    out.close();
+    DeleteOutputFile(params.out_file);
+    ASSERT_EQ(contents.size(), BINARY_HEADER_SIZE + n * (3 * 8 + 2 * 4));
+    EXPECT_EQ(contents.compare(0, 8, BINARY_OUTPUT_MAGIC, 8), 0);
+
+    const char *body = contents.data() + BINARY_HEADER_SIZE;
+    for (std::size_t i = 0; i < n; i++) {
+        double A_btl__db, E_dBuVm, P_rx__dbm;
+        std::int32_t method, rtn;
+        std::memcpy(&A_btl__db, body + 8 * i, 8);
+        std::memcpy(&E_dBuVm, body + 8 * (n + i), 8);
+        std::memcpy(&P_rx__dbm, body + 8 * (2 * n + i), 8);
+        std::memcpy(&method, body + 24 * n + 4 * i, 4);
+        std::memcpy(&rtn, body + 28 * n + 4 * i, 4);
+
+        Result expected;
+        const ReturnCode expected_rtn = LFMF_CPP(
+            columns[0][i],
+            columns[1][i],
+            columns[2][i],
+            columns[3][i],
+            columns[4][i],
+            columns[5][i],
+            columns[6][i],
+            columns[7][i],
+            static_cast<Polarization>(pol[i]),
+            expected
+        );
+        EXPECT_EQ(rtn, expected_rtn);
+        if (expected_rtn == SUCCESS) {
+            EXPECT_DOUBLE_EQ(A_btl__db, expected.A_btl__db);
+            EXPECT_DOUBLE_EQ(E_dBuVm, expected.E_dBuVm);
+            EXPECT_DOUBLE_EQ(P_rx__dbm, expected.P_rx__dbm);
+            EXPECT_EQ(method, static_cast<int>(expected.method));
+        } else {
+            EXPECT_TRUE(std::isnan(A_btl__db));
+            EXPECT_EQ(method, -1);
+        }
+    }
+}
+
+TEST_F(BatchDriverTest, BinaryHeaderError) {
+    // Text input, which is not a binary input file
+    std::string report;
+    EXPECT_EQ(
+        RunBatch(Scenario(10), "-bin", report), DRVRERR__PARSE_BINARY_HEADER
+    );
+}
+
+#ifdef __linux__
+TEST_F(BatchDriverTest, BinaryWriteError) {
+    // Writes to /dev/full fail as if the disk were full
+    const std::uint64_t n = 0;
+    const TempTextFile tempFile("");
+    std::ofstream in(
+        tempFile.getFileName(), std::ios::binary | std::ios::trunc
+    );
+    in.write(BINARY_INPUT_MAGIC, 8);
+    in.write(reinterpret_cast<const char *>(&n), 8);
+    in.close();
+
+    std::string cmd = executable + " -bin -i " + tempFile.getFileName()
+                    + " -o /dev/full";
+    SuppressOutputs(cmd);
+    EXPECT_EQ(RunCommand(cmd), DRVRERR__WRITING_OUTPUT_FILE);
+}
+
+TEST_F(BatchDriverTest, CsvWriteError) {
+    const TempTextFile tempFile(
+        "h_tx__meter,h_rx__meter,f__mhz,p_tx__watt,n_s,d__km,epsilon,sigma,"
+        "pol\n0,0,0.01,1000,301,10,15,0.005,0\n"
+    );
+    std::string cmd = executable + " -b -csv -i " + tempFile.getFileName()
+                    + " -o /dev/full";
+    SuppressOutputs(cmd);
+    EXPECT_EQ(RunCommand(cmd), DRVRERR__WRITING_OUTPUT_FILE);
+}
+
+TEST_F(BatchDriverTest, TextWriteError) {
+    const TempTextFile tempFile(Scenario(10) + Scenario(20));
+    std::string cmd = executable + " -b -i " + tempFile.getFileName()
+                    + " -o /dev/full";
+    SuppressOutputs(cmd);
+    EXPECT_EQ(RunCommand(cmd), DRVRERR__WRITING_OUTPUT_FILE);
+}
+#endif
+
+#ifndef _WIN32
+TEST_F(BatchDriverTest, ServerKeepsFileWhichIsNotSocket) {
+    // A regular file at the socket path must not be deleted
+    const TempTextFile tempFile("not a socket");
+    std::string cmd = executable + " -serve -socket " + tempFile.getFileName();
+    SuppressOutputs(cmd);
+    EXPECT_EQ(RunCommand(cmd), DRVRERR__SERVER_SOCKET);
+
+    std::ifstream kept(tempFile.getFileName());
+    std::string contents(
+        (std::istreambuf_iterator<char>(kept)), std::istreambuf_iterator<char>()
+    );
+    EXPECT_EQ(contents, "not a socket");
+}
+
+TEST_F(BatchDriverTest, ServerAnswersRequestsInOrder) {
+    // Requests hold the input values in the order of `LFMFParams`
+    std::string requests;
+    const int n = 12;
+    for (int i = 0; i < n; i++) {
+        requests += "0,0,0.01,1000,301,"
+                  + std::to_string(i % 2 == 0 ? 1.0 + i : 1000.0 + 10 * i)
+                  + ",15,0.005,0\n";
+    }
+    requests += "0,0,0.01,1000,301,-5,15,0.005,0\n";  // Invalid distance
+    requests += "0,0,0.01\n";                          // Missing values
+    TempTextFile requestFile(requests);
+
+    std::string cmd = executable + " -serve < " + requestFile.getFileName()
+                    + " > " + params.out_file + " 2>/dev/null";
+    EXPECT_EQ(RunCommand(cmd), SUCCESS);
+
+    std::ifstream out(params.out_file);
+    std::string report(
+        (std::istreambuf_iterator<char>(out)), std::istreambuf_iterator<char>()
+    );
+    out.close();
+    DeleteOutputFile(params.out_file);
+
+    std::size_t pos = 0;
+    for (int i = 1; i <= n; i++) {
+        const std::string row = std::to_string(i) + ",0,";
+        EXPECT_EQ(report.compare(pos, row.size(), row), 0) << row;
+        pos = report.find('\n', pos) + 1;
+    }
+    Result expected;
+    const ReturnCode invalid = LFMF_CPP(
+        0, 0, 0.01, 1000, 301, -5, 15, 0.005, Polarization::HORIZONTAL, expected
+    );
+    EXPECT_EQ(
+        report.substr(pos),
+        std::to_string(n + 1) + "," + std::to_string(invalid) + ",,,,\n"
+            + std::to_string(n + 2) + ","
+            + std::to_string(DRVRERR__PARSE_CSV_ROW) + ",,,,\n"
+    );
+}
+
+TEST_F(BatchDriverTest, ServerDropsTooLongRequest) {
+    std::string requests = "0,0,0.01,1000,301,10,15,0.005,0\n";
+    requests += std::string(2 * 1048576, '0') + "\n";
+    requests += "0,0,0.01,1000,301,20,15,0.005,0\n";  // Never answered
+    TempTextFile requestFile(requests);
+
+    std::string cmd = executable + " -serve < " + requestFile.getFileName()
+                    + " > " + params.out_file + " 2>/dev/null";
+    EXPECT_EQ(RunCommand(cmd), SUCCESS);
+
+    std::ifstream out(params.out_file);
+    std::string report(
+        (std::istreambuf_iterator<char>(out)), std::istreambuf_iterator<char>()
+    );
+    out.close();
+    DeleteOutputFile(params.out_file);
+
+    const std::size_t second = report.find('\n') + 1;
+    EXPECT_EQ(report.compare(0, 4, "1,0,"), 0);
+    EXPECT_EQ(
+        report.substr(second),
+        "2," + std::to_string(DRVRERR__PARSE_CSV_ROW) + ",,,,\n"
+    );
+}
+#endif
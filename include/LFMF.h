@@ -3,9 +3,14 @@
  */
 #pragma once
 
-#include <cfloat>   // for DBL_EPSILON
-#include <complex>  // for std::complex
-#include <string>   // for std::string
+#include <cfloat>      // for DBL_EPSILON
+#include <complex>     // for std::complex
+#include <cstddef>     // for std::size_t
+#include <functional>  // for std::function
+#include <memory>      // for std::unique_ptr
+#include <mutex>       // for std::mutex
+#include <string>      // for std::string
+#include <vector>      // for std::vector
 
 namespace ITS {
 namespace Propagation {
@@ -80,6 +85,31 @@ enum class AiryScaling {
     NONE,    /**< No Scaling */
 };
 
+/*******************************************************************************
+ * Accuracy tiers of the tabulated Airy functions of `FastAiry()`.
+ *
+ * Each tier bounds the truncation error of the tabulated approximations,
+ * relative to the size of the function near the argument. Higher tiers sum
+ * more terms.
+ *
+ * @see ITS::Propagation::LFMF::FastAiry
+ ******************************************************************************/
+enum class AiryAccuracy {
+    LOW,      /**< Truncation error below 1e-4 */
+    STANDARD, /**< Truncation error below 1e-8, well within that of `Airy()` */
+    HIGH,     /**< Truncation error below 1e-13 */
+};
+
+/*******************************************************************************
+ * Iterations used by `WiRoot()` to refine a root from its starting point.
+ *
+ * @see ITS::Propagation::LFMF::WiRoot
+ ******************************************************************************/
+enum class WiRootIteration {
+    NEWTON, /**< Newton's method, of second order */
+    HALLEY, /**< Halley's method, of third order */
+};
+
 /*******************************************************************************
  * Return Codes defined by this software (0-127)
  ******************************************************************************/
@@ -97,6 +127,15 @@ enum ReturnCode {
     ERROR__EPSILON,                     /**< Epsilon is out of range */
     ERROR__SIGMA,                       /**< Sigma is out of range */
     ERROR__POLARIZATION,                /**< Invalid value for polarization */
+
+    // Numerical Failures
+    ERROR__AIRY_ARGUMENT = 64,          /**< Invalid kind or scaling of Airy function */
+    ERROR__AIRY_RANGE,                  /**< Airy function argument is outside the range of its expansion data */
+    ERROR__WIROOT_ARGUMENT,             /**< Invalid root index, kind, or scaling of root search */
+    ERROR__WIROOT_CONVERGENCE,          /**< Residue series root search did not converge */
+
+    // Execution Failures
+    ERROR__EXECUTION = 96,              /**< Threads could not be started, or a batch stopped unexpectedly */
 };
 // clang-format on
 
@@ -121,6 +160,219 @@ struct Result {
         SolutionMethod method; /**< Method used to obtain results */
 };
 
+/** Usage statistics of the residue series root cache. */
+// clang-format off
+struct RootCacheStats {
+        std::size_t capacity;          /**< Maximum number of cached values of q */
+        std::size_t size;              /**< Number of cached values of q */
+        unsigned long long hits;       /**< Lookups which found cached roots */
+        unsigned long long misses;     /**< Lookups which found no cached roots */
+        unsigned long long evictions;  /**< Entries evicted to respect the capacity */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Process-wide options of the residue series, applied to the modes of every
+ * later prediction.
+ *
+ * @see ITS::Propagation::LFMF::SetResidueSeriesOptions
+ ******************************************************************************/
+// clang-format off
+struct ResidueSeriesOptions {
+        std::size_t root_block = 0;  /**< If nonzero, roots without a seed are found this many at a time by `TryWiRootBlock()` */
+        bool accelerate = false;     /**< If true, partial sums are accelerated by Wynn's epsilon algorithm */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Intermediate values which depend only on frequency, ground constants,
+ * polarization, and surface refractivity.
+ *
+ * Paths which share these inputs can reuse one instance of this structure
+ * instead of recomputing it for each prediction.
+ ******************************************************************************/
+// clang-format off
+struct PropagationConstants {
+        double f__mhz;              /**< Frequency, in MHz */
+        double N_s;                 /**< Surface refractivity, in N-Units */
+        double epsilon;             /**< Relative permittivity */
+        double sigma;               /**< Conductivity, in siemens per meter */
+        Polarization pol;           /**< Polarization */
+        double f__hz;               /**< Frequency, in Hz */
+        double a_e__km;             /**< Effective earth radius, in km */
+        double k;                   /**< Wavenumber, in rad/km */
+        double nu;                  /**< Intermediate value, cbrt(a_e__km * k / 2) */
+        std::complex<double> delta; /**< Surface impedance */
+        std::complex<double> q;     /**< Intermediate value -j*nu*delta */
+        double d_test__km;          /**< Distance at which the residue series is used, in km */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Roots used by the residue series, which depend only on the intermediate
+ * value q.
+ *
+ * When `T_seed` holds roots found for a nearby value `q_seed`, new roots are
+ * found by continuation from those roots instead of from the Airy zeros.
+ *
+ * @see ITS::Propagation::LFMF::AddResidueSeriesRoot
+ * @see ITS::Propagation::LFMF::SeedResidueSeriesRoots
+ ******************************************************************************/
+// clang-format off
+struct ResidueSeriesRoots {
+        std::complex<double> q;                    /**< Intermediate value -j*nu*delta */
+        std::vector<std::complex<double>> T;       /**< Roots t_i of Wi'(t) - q*Wi(t) = 0 */
+        std::vector<std::complex<double>> W1;      /**< Wi(t_i) at each root */
+        std::complex<double> q_seed;               /**< Value of q for which `T_seed` was found */
+        std::vector<std::complex<double>> T_seed;  /**< Roots used to start the root search */
+        long newton_iterations = 0;                /**< Newton iterations used to find `T` */
+        std::size_t n_cached = 0;                  /**< Number of roots in `T` known to the root cache */
+        std::size_t root_block = 0;                /**< If nonzero, roots without a seed are found this many at a time by `TryWiRootBlock()` */
+        ReturnCode status = SUCCESS;               /**< First failure to find a root; no roots are added after it */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Terms of the residue series which do not depend on path distance.
+ *
+ * Modes are computed on demand, so that one instance can be summed at many
+ * path distances while finding each root and height-gain value only once.
+ * The series is symmetric in the two antennas, so `y_1` and `y_2` may also be
+ * used for the transmitter and receiver regardless of which is higher.
+ *
+ * @see ITS::Propagation::LFMF::InitializeResidueSeriesModes
+ * @see ITS::Propagation::LFMF::ResidueSeriesField
+ ******************************************************************************/
+// clang-format off
+struct ResidueSeriesModes {
+        double y_1;                             /**< Height-gain argument k*h_1/nu of the first antenna */
+        double y_2;                             /**< Height-gain argument k*h_2/nu of the second antenna */
+        ResidueSeriesRoots roots;               /**< Roots of the series */
+        std::vector<std::complex<double>> H_1;  /**< Height-gain function of the first antenna at each root */
+        std::vector<std::complex<double>> H_2;  /**< Height-gain function of the second antenna at each root */
+        std::vector<std::complex<double>> W;    /**< Coefficient of the distance factor of each mode */
+        bool accelerate = false;                /**< If true, partial sums are accelerated by Wynn's epsilon algorithm */
+        std::vector<std::complex<double>> wynn; /**< Wynn's epsilon tables of `ResidueSeriesFields()`, kept between calls */
+};
+// clang-format on
+
+/*******************************************************************************
+ * One radial of a coverage grid: the ground constants along the radial and
+ * the distances from the transmitter at which to predict.
+ *
+ * @see ITS::Propagation::LFMF::LFMFCoverage
+ ******************************************************************************/
+// clang-format off
+struct CoverageRadial {
+        double epsilon;             /**< Relative permittivity */
+        double sigma;               /**< Conductivity */
+        std::vector<double> d__km;  /**< Path distances, in km */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Predictions over a polar grid around a transmitter.
+ *
+ * Each matrix has one row per radial and one column per distance, stored
+ * row-major: the cell for distance `j` of radial `i` is at
+ * `i * n_distances + j`. Radials with fewer distances than the longest radial
+ * are padded with NaN.
+ *
+ * @see ITS::Propagation::LFMF::LFMFCoverage
+ ******************************************************************************/
+// clang-format off
+struct CoverageGrid {
+        std::size_t n_radials;           /**< Number of rows */
+        std::size_t n_distances;         /**< Number of columns */
+        std::vector<double> d__km;       /**< Path distance, in km */
+        std::vector<double> E_dBuVm;     /**< Electric field strength, in dB(uV/m) */
+        std::vector<double> A_btl__db;   /**< Basic transmission loss, in dB */
+        std::vector<double> P_rx__dbm;   /**< Received power, in dBm */
+        std::vector<ReturnCode> rtns;    /**< Return code of each cell; `SUCCESS` for padding */
+};
+// clang-format on
+
+/*******************************************************************************
+ * Residue series state for one set of path-independent inputs, which can be
+ * reused to predict many paths.
+ *
+ * A mode set is built once from frequency, surface refractivity, ground
+ * constants, and polarization. `Evaluate()` then gives the same result as
+ * `LFMF_CPP()` for any antenna heights, transmitter power, and distance,
+ * while the residue series roots are found only once, as they are needed.
+ *
+ * `Evaluate()` may be called from several threads at once. A mode set cannot
+ * be copied.
+ *
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ ******************************************************************************/
+class ModeSet {
+    public:
+        ModeSet(
+            const double f__mhz,
+            const double N_s,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        );
+        ModeSet(const ModeSet &) = delete;
+        ModeSet &operator=(const ModeSet &) = delete;
+
+        ReturnCode GetStatus() const;
+        const PropagationConstants &GetConstants() const;
+        void GetRoots(
+            std::vector<std::complex<double>> &T,
+            std::vector<std::complex<double>> &W1
+        ) const;
+        ReturnCode Evaluate(
+            const double h_tx__meter,
+            const double h_rx__meter,
+            const double P_tx__watt,
+            const double d__km,
+            Result &result
+        ) const;
+
+    private:
+        ReturnCode status;                /**< Validation of inputs */
+        PropagationConstants constants;   /**< Intermediate values */
+        mutable std::mutex roots_mutex;   /**< Guards `roots` */
+        mutable ResidueSeriesRoots roots; /**< Roots found so far */
+};
+
+/*******************************************************************************
+ * Work-stealing thread pool for batches of independent evaluations.
+ *
+ * `ParallelFor()` divides a range of indices into chunks and gives each
+ * thread an equal, contiguous share of the chunks. A thread which finishes
+ * its share takes chunks from the end of the share of another thread, so
+ * threads with cheap points help those with expensive ones. The calling
+ * thread works too. Output written by index is independent of which thread
+ * evaluated it, so results are deterministic.
+ *
+ * Calls to `ParallelFor()` from several threads take turns. A call made from
+ * inside the body of another call runs on the calling thread only.
+ ******************************************************************************/
+class Executor {
+    public:
+        explicit Executor(const unsigned int n_threads = 0);
+        ~Executor();
+        Executor(const Executor &) = delete;
+        Executor &operator=(const Executor &) = delete;
+
+        unsigned int GetThreadCount() const;
+        void ParallelFor(
+            const std::size_t n,
+            const std::size_t chunk_size,
+            const std::function<void(std::size_t, std::size_t)> &body
+        );
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> impl; /**< Threads and work queues */
+
+        void Stop();
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 
@@ -137,6 +389,44 @@ DLLEXPORT ReturnCode LFMF(
     Result &result
 );
 
+DLLEXPORT ReturnCode LFMFBatch(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const int *pol,
+    Result *results,
+    ReturnCode *rtns
+);
+
+DLLEXPORT void SetRootCacheCapacity(const std::size_t capacity);
+DLLEXPORT void GetRootCacheStats(RootCacheStats &stats);
+DLLEXPORT void ClearRootCache();
+DLLEXPORT void SetResidueSeriesOptions(const ResidueSeriesOptions &options);
+DLLEXPORT void GetResidueSeriesOptions(ResidueSeriesOptions &options);
+
+DLLEXPORT ReturnCode LFMFBatchParallel(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const int *pol,
+    Result *results,
+    ReturnCode *rtns,
+    const unsigned int n_threads,
+    const std::size_t chunk_size
+);
+
 DLLEXPORT char *GetReturnStatusCharArray(const int code);
 DLLEXPORT void FreeReturnStatusCharArray(char *c_msg);
 
@@ -155,6 +445,135 @@ ReturnCode LFMF_CPP(
     const Polarization pol,
     Result &result
 );
+ReturnCode LFMFBatch_CPP(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const Polarization *pol,
+    Result *results,
+    ReturnCode *rtns
+);
+Executor &SharedExecutor(const unsigned int n_threads);
+ReturnCode LFMFBatchParallel_CPP(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const Polarization *pol,
+    Result *results,
+    ReturnCode *rtns,
+    Executor &executor,
+    const std::size_t chunk_size
+);
+void ComputePropagationConstants(
+    const double f__mhz,
+    const double N_s,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    PropagationConstants &constants
+);
+ReturnCode EvaluateLFMF(
+    const PropagationConstants &constants,
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double P_tx__watt,
+    const double d__km,
+    Result &result
+);
+ReturnCode EvaluateLFMFContinued(
+    const PropagationConstants &constants,
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double P_tx__watt,
+    const double d__km,
+    ResidueSeriesRoots &seed,
+    long &newton_iterations,
+    Result &result
+);
+void FieldStrengthToResult(
+    const PropagationConstants &constants,
+    const double E_gw,
+    const double P_tx__watt,
+    const double d__km,
+    Result &result
+);
+ReturnCode LFMFDistanceSweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const std::vector<double> &d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns
+);
+ReturnCode LFMFFrequencySweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const std::vector<double> &f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const double d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns,
+    long &newton_iterations
+);
+ReturnCode LFMFGroundSweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const double d__km,
+    const std::vector<double> &epsilon,
+    const std::vector<double> &sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns,
+    long &newton_iterations
+);
+ReturnCode LFMFCoverage(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const Polarization pol,
+    const std::vector<CoverageRadial> &radials,
+    const unsigned int n_threads,
+    CoverageGrid &grid
+);
+ReturnCode LFMFHeightSweep(
+    const double h_tx__meter,
+    const std::vector<double> &h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const std::vector<double> &d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns
+);
 std::string GetReturnStatus(const int code);
 double FlatEarthCurveCorrection(
     const std::complex<double> delta,
@@ -165,18 +584,141 @@ double FlatEarthCurveCorrection(
     const double k,
     const double a_e__km
 );
-double ResidueSeries(
+std::complex<double> FlatEarthAttenuation(
+    const std::complex<double> delta,
+    const std::complex<double> q,
+    const double d__km,
+    const double k,
+    const double a_e__km
+);
+void FlatEarthAttenuation(
+    const std::complex<double> delta,
+    const std::complex<double> q,
+    const std::size_t n,
+    const double *d__km,
+    const double k,
+    const double a_e__km,
+    std::complex<double> *fofx
+);
+double FlatEarthHeightGain(
+    const std::complex<double> fofx,
+    const std::complex<double> delta,
+    const double h_1__km,
+    const double h_2__km,
+    const double k
+);
+ReturnCode ResidueSeries(
     const double k,
     const double h_1__km,
     const double h_2__km,
     const double nu,
     const double theta,
-    const std::complex<double> q
+    const std::complex<double> q,
+    double &E_gw
+);
+void InitializeResidueSeriesModes(
+    const double k,
+    const double h_1__km,
+    const double h_2__km,
+    const double nu,
+    const std::complex<double> q,
+    ResidueSeriesModes &modes
+);
+void UpdateResidueSeriesHeights(
+    ResidueSeriesModes &modes, const double y_1, const double y_2
+);
+void SeedResidueSeriesRoots(
+    ResidueSeriesRoots &roots, const ResidueSeriesRoots &seed
+);
+void AddResidueSeriesRoot(ResidueSeriesRoots &roots);
+void AddResidueSeriesRootBlock(
+    ResidueSeriesRoots &roots, const std::size_t n
+);
+void ComputeResidueSeriesModes(ResidueSeriesModes &modes, const std::size_t n);
+void StoreResidueSeriesRoots(ResidueSeriesRoots &roots);
+double ResidueSeriesField(ResidueSeriesModes &modes, const double x);
+void ResidueSeriesFields(
+    ResidueSeriesModes &modes,
+    const std::size_t n,
+    const double *x,
+    double *E_gw
+);
+bool LookupRootCache(
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::vector<std::complex<double>> &T,
+    std::vector<std::complex<double>> &W1
+);
+void StoreRootCache(
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const std::vector<std::complex<double>> &T,
+    const std::vector<std::complex<double>> &W1
 );
 std::complex<double> wofz(const std::complex<double> z);
+void wofz(
+    const std::size_t n, const std::complex<double> *z, std::complex<double> *w
+);
 std::complex<double> Airy(
     const std::complex<double> Z, const AiryKind kind, const AiryScaling scaling
 );
+void Airy(
+    const std::size_t n,
+    const std::complex<double> *Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *Ai
+);
+ReturnCode TryAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &Ai
+) noexcept;
+ReturnCode TryAiry(
+    const std::size_t n,
+    const std::complex<double> *Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *Ai
+) noexcept;
+void AiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &F,
+    std::complex<double> &DF
+);
+ReturnCode TryAiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &F,
+    std::complex<double> &DF
+) noexcept;
+ReturnCode FastAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const AiryAccuracy accuracy,
+    std::complex<double> &Ai
+) noexcept;
+ReturnCode FastAiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const AiryAccuracy accuracy,
+    std::complex<double> &F,
+    std::complex<double> &DF
+) noexcept;
+ReturnCode ResidueSeriesAiry(
+    const std::complex<double> T, std::complex<double> &W1
+) noexcept;
+ReturnCode ResidueSeriesAiry(
+    const std::size_t n, const std::complex<double> *T, std::complex<double> *W1
+) noexcept;
 std::complex<double> WiRoot(
     const int i,
     std::complex<double> &DWi,
@@ -185,6 +727,65 @@ std::complex<double> WiRoot(
     const AiryKind kind,
     const AiryScaling scaling
 );
+std::complex<double> WiRoot(
+    const int i,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration = WiRootIteration::NEWTON
+);
+std::complex<double> RefineWiRoot(
+    std::complex<double> ti,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration = WiRootIteration::NEWTON
+);
+ReturnCode TryWiRoot(
+    const int i,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &ti,
+    int &iterations,
+    const WiRootIteration iteration = WiRootIteration::NEWTON
+) noexcept;
+ReturnCode TryRefineWiRoot(
+    std::complex<double> &ti,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration = WiRootIteration::NEWTON
+) noexcept;
+ReturnCode TryWiRootBlock(
+    const int first,
+    const std::size_t n,
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *ti,
+    long &iterations,
+    const std::complex<double> *t_prev = nullptr
+) noexcept;
+std::complex<double> ExtrapolateWiRoot(
+    const int i,
+    const std::complex<double> t_1,
+    const std::complex<double> t_2,
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling
+) noexcept;
 ReturnCode ValidateInput(
     const double h_tx__meter,
     const double h_rx__meter,
@@ -195,6 +796,12 @@ ReturnCode ValidateInput(
     const double epsilon,
     const double sigma
 );
+ReturnCode ValidateModeSetInput(
+    const double f__mhz,
+    const double N_s,
+    const double epsilon,
+    const double sigma
+);
 ReturnCode ValidatePolarization(const Polarization pol);
 bool AlmostEqualRelative(
     const double A, const double B, const double maxRelDiff = DBL_EPSILON
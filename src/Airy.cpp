@@ -1,11 +1,16 @@
 /** @file Airy.cpp
- * Implements a function to calculate Airy functions and their derivatives.
+ * Implements functions to calculate Airy functions and their derivatives.
  */
 
 #include "LFMF.h"
+#include "AiryTables.h"
 
-#include <cmath>      // for abs, copysign, cos, exp, pow, sin, sqrt
+#include <algorithm>  // for std::min
+#include <cmath>      // for abs, copysign, cos, exp, hypot, pow, sin, sqrt
 #include <complex>    // for std::arg, std::complex
+#include <cstddef>    // for std::size_t
+#include <cstdio>     // for std::fprintf
+#include <cstdlib>    // for std::abort
 #include <sstream>    // for std::ostringstream
 #include <stdexcept>  // for std::invalid_argument, std::range_error
 
@@ -13,6 +18,968 @@ namespace ITS {
 namespace Propagation {
 namespace LFMF {
 
+namespace {
+
+// Centers of Expansion of Taylor series on real axis indices into the AV,
+// APV, BV, and BPV arrays
+constexpr int NQTT[15]
+    = {1, 3, 7, 12, 17, 23, 29, 35, 41, 47, 53, 59, 64, 68, 71};
+
+// terms for asymptotic series. second column is for derivative
+constexpr int SIZE_OF_ASV = 15;
+constexpr double ASV[SIZE_OF_ASV][2]
+    = {{0.5989251E+5, -0.6133571E+5},
+       {0.9207207E+4, -0.9446355E+4},
+       {0.1533169E+4, -0.1576357E+4},
+       {0.2784651E+3, -0.2870332E+3},
+       {0.5562279E+2, -0.5750830E+2},
+       {0.1234157E+2, -0.1280729E+2},
+       {0.3079453E+1, -0.3210494E+1},
+       {0.8776670E+0, -0.9204800E+0},
+       {0.2915914E+0, -0.3082538E+0},
+       {0.1160991E+0, -0.1241059E+0},
+       {0.5764919E-1, -0.6266216E-1},
+       {0.3799306E-1, -0.4246283E-1},
+       {0.3713349E-1, -0.4388503E-1},
+       {0.6944444E-1, -0.9722222E-1},
+       {0.1000000E+1, 0.1000000E+1}};
+
+//////////////////////////////////////////////////////////////////////////
+// Initialize the center of expansion arrays.                           //
+//////////////////////////////////////////////////////////////////////////
+// The array AV[] (and BV[]) is the Airy function for Ai(a) to shift    //
+// the Taylor series from the origin to the point a Thus the series is  //
+// f(z -a)                                                              //
+// Why George Hufford choose these particular locations for the         //
+// of the centers of expansion is unknown. The centers of expansion are //
+// included here to remove any ambiguity in the method.                 //
+//////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////   Center of expansion
+///////////////////////////////////////////////////   ( Real, Imaginary)
+
+// Complex array of the value Ai(a) Airy function
+// where a is the complex location of the center of expansion of the Taylor series
+constexpr std::complex<double> AV[] = {
+    {-3.2914520e-001, +0.0000000e+000},  //   (-6,0)
+    {-2.6780040e+000, +1.4774590e+000},  //   (-6,1/sin(pi/3))
+    {+3.5076100e-001, +0.0000000e+000},  //   (-5,0)
+    {+2.4122260e+000, +6.9865120e-001},  //   (-5,1/sin(pi/3))
+    {+3.3635530e+001, -3.4600960e+000},  //   (-5,2/sin(pi/3))
+    {+3.4449740e+002, -3.3690890e+002},  //   (-5,3/sin(pi/3))
+    {-7.0265530e-002, +0.0000000e+000},  //   (-4,0)
+    {-5.4818220e-001, -1.9207370e+000},  //   (-4,1/sin(pi/3))
+    {-1.3383400e+001, -1.6022590e+001},  //   (-4,2/sin(pi/3))
+    {-2.2967800e+002, -3.2072450e+001},  //   (-4,3/sin(pi/3))
+    {-1.8040780e+003, +2.1917680e+003},  //   (-4,4/sin(pi/3))
+    {-3.7881430e-001, +0.0000000e+000},  //   (-3,0)
+    {-1.3491840e+000, +8.4969080e-001},  //   (-3,1/sin(pi/3))
+    {-6.0453340e+000, +1.0623180e+001},  //   (-3,2/sin(pi/3))
+    {+3.1169620e+001, +9.8813520e+001},  //   (-3,3/sin(pi/3))
+    {+9.8925350e+002, +1.3905290e+002},  //   (-3,4/sin(pi/3))
+    {+2.2740740e-001, +0.0000000e+000},  //   (-2,0)
+    {+7.1857400e-001, +9.7809090e-001},  //   (-2,1/sin(pi/3))
+    {+6.0621090e+000, +2.7203010e+000},  //   (-2,2/sin(pi/3))
+    {+3.6307080e+001, -2.0961360e+001},  //   (-2,3/sin(pi/3))
+    {-6.7139790e+001, -3.0904640e+002},  //   (-2,4/sin(pi/3))
+    {-2.8001650e+003, +4.6649370e+002},  //   (-2,5/sin(pi/3))
+    {+5.3556090e-001, +0.0000000e+000},  //   (-1,0)
+    {+9.2407370e-001, -1.9106560e-001},  //   (-1,1/sin(pi/3))
+    {+1.8716190e+000, -2.5743310e+000},  //   (-1,2/sin(pi/3))
+    {-7.2188440e+000, -1.2924200e+001},  //   (-1,3/sin(pi/3))
+    {-8.1787380e+001, +3.2087010e+001},  //   (-1,4/sin(pi/3))
+    {+2.9933950e+002, +5.6922180e+002},  //   (-1,5/sin(pi/3))
+    {+3.5502810e-001, +0.0000000e+000},  //   ( 0,0)
+    {+3.1203440e-001, -3.8845390e-001},  //   ( 0,1/sin(pi/3))
+    {-5.2840000e-001, -1.0976410e+000},  //   ( 0,2/sin(pi/3))
+    {-4.2009350e+000, +1.1940150e+000},  //   ( 0,3/sin(pi/3))
+    {+7.1858830e+000, +1.9600910e+001},  //   ( 0,4/sin(pi/3))
+    {+1.0129120e+002, -7.5951230e+001},  //   ( 0,5/sin(pi/3))
+    {+1.3529240e-001, +0.0000000e+000},  //   ( 1,0)
+    {+3.2618480e-002, -1.7084870e-001},  //   ( 1,1/sin(pi/3))
+    {-3.4215380e-001, -8.9067650e-002},  //   ( 1,2/sin(pi/3))
+    {-1.4509640e-001, +1.0328020e+000},  //   ( 1,3/sin(pi/3))
+    {+4.1001970e+000, -6.8936910e-001},  //   ( 1,4/sin(pi/3))
+    {-1.3030120e+001, -1.6910540e+001},  //   ( 1,5/sin(pi/3))
+    {+3.4924130e-002, +0.0000000e+000},  //   ( 2,0)
+    {-8.4464730e-003, -4.2045150e-002},  //   ( 2,1/sin(pi/3))
+    {-6.9313270e-002, +3.5364800e-002},  //   ( 2,2/sin(pi/3))
+    {+1.5227620e-001, +1.2848450e-001},  //   ( 2,3/sin(pi/3))
+    {+1.0681370e-001, -6.7766150e-001},  //   ( 2,4/sin(pi/3))
+    {-2.6193430e+000, +1.5699860e+000},  //   ( 2,5/sin(pi/3))
+    {+6.5911390e-003, +0.0000000e+000},  //   ( 3,0)
+    {-3.9443990e-003, -6.8060110e-003},  //   ( 3,1/sin(pi/3))
+    {-5.9820130e-003, +1.1799010e-002},  //   ( 3,2/sin(pi/3))
+    {+2.9922500e-002, -5.9772930e-003},  //   ( 3,3/sin(pi/3))
+    {-7.7464130e-002, -5.2292400e-002},  //   ( 3,4/sin(pi/3))
+    {+1.1276590e-001, +3.5112440e-001},  //   ( 3,5/sin(pi/3))
+    {+9.5156390e-004, +0.0000000e+000},  //   ( 4,0)
+    {-8.0843000e-004, -7.6590130e-004},  //   ( 4,1/sin(pi/3))
+    {+1.6147820e-004, +1.7661760e-003},  //   ( 4,2/sin(pi/3))
+    {+2.0138720e-003, -3.1976720e-003},  //   ( 4,3/sin(pi/3))
+    {-9.5086780e-003, +4.5377830e-003},  //   ( 4,4/sin(pi/3))
+    {+3.7560190e-002, +5.7361920e-004},  //   ( 4,5/sin(pi/3))
+    {+1.0834440e-004, +0.0000000e+000},  //   ( 5,0)
+    {-1.0968610e-004, -5.9902330e-005},  //   ( 5,1/sin(pi/3))
+    {+1.0778190e-004, +1.5771600e-004},  //   ( 5,2/sin(pi/3))
+    {-6.8980940e-005, -3.7626460e-004},  //   ( 5,3/sin(pi/3))
+    {-1.6166130e-004, +9.7457770e-004},  //   ( 5,4/sin(pi/3))
+    {+9.9476940e-006, +0.0000000e+000},  //   ( 6,0)
+    {-1.0956820e-005, -2.9508800e-006},  //   ( 6,1/sin(pi/3))
+    {+1.4709070e-005, +8.1042090e-006},  //   ( 6,2/sin(pi/3))
+    {-2.4446020e-005, -2.0638140e-005},  //   ( 6,3/sin(pi/3))
+    {+7.4921290e-007, +0.0000000e+000},  //   ( 7,0)
+    {-8.4619070e-007, -3.6807340e-008},  //   ( 7,1/sin(pi/3))
+    {+1.2183960e-006, +8.3589200e-008}   //   ( 7,2/sin(pi/3))
+};
+//////////////////////////////////////////////////////////////////////////
+// This array APV[] is the derivative of the Airy function for Ai'(a)   //
+//////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////   Center of expansion
+///////////////////////////////////////////////////   ( Real, Imaginary)
+// Complex array of the value Ai'(a) derivative of the Airy function
+// where a is the complex location of the center of expansion of the Taylor series
+// presumably for Ai'[z]
+constexpr std::complex<double> APV[] = {
+    {+3.4593550e-001, +0.0000000e+000},  //  (-6,0)
+    {+4.1708880e+000, +6.2414440e+000},  //  (-6,1/sin(pi/3))
+    {+3.2719280e-001, +0.0000000e+000},  //  (-5,0)
+    {+1.0828740e+000, -5.4928300e+000},  //  (-5,1/sin(pi/3))
+    {-2.3363520e+001, -7.4901850e+001},  //  (-5,2/sin(pi/3))
+    {-1.0264880e+003, -5.6707940e+002},  //  (-5,3/sin(pi/3))
+    {-7.9062860e-001, +0.0000000e+000},  //  (-4,0)
+    {-3.8085830e+000, +1.5129610e+000},  //  (-4,1/sin(pi/3))
+    {-2.6086380e+001, +3.5540710e+001},  //  (-4,2/sin(pi/3))
+    {+1.0761840e+002, +5.1239940e+002},  //  (-4,3/sin(pi/3))
+    {+6.6597800e+003, +1.8096190e+003},  //  (-4,4/sin(pi/3))
+    {+3.1458380e-001, +0.0000000e+000},  //  (-3,0)
+    {+1.8715430e+000, +2.0544840e+000},  //  (-3,1/sin(pi/3))
+    {+2.2591740e+001, +4.8563000e+000},  //  (-3,2/sin(pi/3))
+    {+1.6163000e+002, -1.4335600e+002},  //  (-3,3/sin(pi/3))
+    {-8.0047160e+002, -2.1527450e+003},  //  (-3,4/sin(pi/3))
+    {+6.1825900e-001, +0.0000000e+000},  //  (-2,0)
+    {+1.3019600e+000, -1.2290770e+000},  //  (-2,1/sin(pi/3))
+    {+1.5036120e-001, -1.1008090e+001},  //  (-2,2/sin(pi/3))
+    {-7.0116800e+001, -4.0480820e+001},  //  (-2,3/sin(pi/3))
+    {-4.8317170e+002, +4.9692760e+002},  //  (-2,4/sin(pi/3))
+    {+4.8970660e+003, +4.8627290e+003},  //  (-2,5/sin(pi/3))
+    {-1.0160570e-002, +0.0000000e+000},  //  (-1,0)
+    {-5.4826640e-001, -7.1365290e-001},  //  (-1,1/sin(pi/3))
+    {-4.6749130e+000, -1.1924250e-001},  //  (-1,2/sin(pi/3))
+    {-1.0536400e+001, +2.4943710e+001},  //  (-1,3/sin(pi/3))
+    {+1.6333770e+002, +9.0394910e+001},  //  (-1,4/sin(pi/3))
+    {+5.6449460e+002, -1.4248320e+003},  //  (-1,5/sin(pi/3))
+    {-2.5881940e-001, +0.0000000e+000},  //  ( 0,0)
+    {-4.8620750e-001, +1.5689920e-001},  //  ( 0,1/sin(pi/3))
+    {-4.7348130e-001, +1.7093440e+000},  //  ( 0,2/sin(pi/3))
+    {+7.0373840e+000, +3.6281820e+000},  //  ( 0,3/sin(pi/3))
+    {+1.7739590e+001, -4.0360420e+001},  //  ( 0,4/sin(pi/3))
+    {-2.9791510e+002, -3.8408890e+001},  //  ( 0,5/sin(pi/3))
+    {-1.5914740e-001, +0.0000000e+000},  //  ( 1,0)
+    {-1.1340420e-001, +1.9730500e-001},  //  ( 1,1/sin(pi/3))
+    {+4.0126210e-001, +3.9223000e-001},  //  ( 1,2/sin(pi/3))
+    {+1.3348650e+000, -1.4377270e+000},  //  ( 1,3/sin(pi/3))
+    {-7.9022490e+000, -4.2063640e+000},  //  ( 1,4/sin(pi/3))
+    {-1.3892750e+000, +5.1229420e+001},  //  ( 1,5/sin(pi/3))
+    {-5.3090380e-002, +0.0000000e+000},  //  ( 2,0)
+    {-1.6832970e-003, +6.8366970e-002},  //  ( 2,1/sin(pi/3))
+    {+1.3789400e-001, -1.1613800e-002},  //  ( 2,2/sin(pi/3))
+    {-1.4713730e-001, -3.7151990e-001},  //  ( 2,3/sin(pi/3))
+    {-1.0070200e+000, +1.1591350e+000},  //  ( 2,4/sin(pi/3))
+    {+7.5045050e+000, +4.6913120e-001},  //  ( 2,5/sin(pi/3))
+    {-1.1912980e-002, +0.0000000e+000},  //  ( 3,0)
+    {+5.1468570e-003, +1.3660890e-002},  //  ( 3,1/sin(pi/3))
+    {+1.8309710e-002, -1.8808590e-002},  //  ( 3,2/sin(pi/3))
+    {-6.4461590e-002, -1.3611790e-002},  //  ( 3,3/sin(pi/3))
+    {+1.0516240e-001, +1.9313050e-001},  //  ( 3,4/sin(pi/3))
+    {+2.0520050e-001, -9.1772620e-001},  //  ( 3,5/sin(pi/3))
+    {-1.9586410e-003, +0.0000000e+000},  //  ( 4,0)
+    {+1.4695650e-003, +1.8086380e-003},  //  ( 4,1/sin(pi/3))
+    {+5.9709950e-004, -3.8332700e-003},  //  ( 4,2/sin(pi/3))
+    {-6.8910890e-003, +5.4467430e-003},  //  ( 4,3/sin(pi/3))
+    {+2.6167930e-002, -8.4092000e-004},  //  ( 4,4/sin(pi/3))
+    {-8.8284470e-002, -4.6475310e-002},  //  ( 4,5/sin(pi/3))
+    {-2.4741390e-004, +0.0000000e+000},  //  ( 5,0)
+    {+2.3707840e-004, +1.6461110e-004},  //  ( 5,1/sin(pi/3))
+    {-1.7465570e-004, -4.2026780e-004},  //  ( 5,2/sin(pi/3))
+    {-1.0394520e-004, +9.4761840e-004},  //  ( 5,3/sin(pi/3))
+    {+1.3004110e-003, -2.2446660e-003},  //  ( 5,4/sin(pi/3))
+    {-2.4765200e-005, +0.0000000e+000},  //  ( 6,0)
+    {+2.6714870e-005, +9.8691570e-006},  //  ( 6,1/sin(pi/3))
+    {-3.3539770e-005, -2.7113280e-005},  //  ( 6,2/sin(pi/3))
+    {+4.9197840e-005, +6.9349090e-005},  //  ( 6,3/sin(pi/3))
+    {-2.0081510e-006, +0.0000000e+000},  //  ( 7,0)
+    {+2.2671240e-006, +2.7848510e-007},  //  ( 7,1/sin(pi/3))
+    {-3.2692130e-006, -7.3943490e-007},  //  ( 7,2/sin(pi/3))
+};
+
+/////////////////////////////////////////////////////////////////////////
+
+// Complex array of the value Bi(a) Airy function
+// where a is the complex location of the center of expansion of the Taylor series
+constexpr std::complex<double> BV[] = {
+    {-1.466984e-001, -9.813078e-017},  // (-6,0)
+    {-1.489391e+000, -2.660635e+000},  // (-6,1/sin(pi/3))
+    {-1.383691e-001, +0.000000e+000},  // (-5,0)
+    {-7.034482e-001, +2.384547e+000},  // (-5,1/sin(pi/3))
+    {+3.460723e+000, +3.363363e+001},  // (-5,2/sin(pi/3))
+    {+3.369090e+002, +3.444973e+002},  // (-5,3/sin(pi/3))
+    {+3.922347e-001, -1.041605e-016},  // (-4,0)
+    {+1.956219e+000, -5.327226e-001},  // (-4,1/sin(pi/3))
+    {+1.602464e+001, -1.338050e+001},  // (-4,2/sin(pi/3))
+    {+3.207239e+001, -2.296777e+002},  // (-4,3/sin(pi/3))
+    {-2.191768e+003, -1.804078e+003},  // (-4,4/sin(pi/3))
+    {-1.982896e-001, +4.440892e-016},  // (-3,0)
+    {-8.880754e-001, -1.308713e+000},  // (-3,1/sin(pi/3))
+    {-1.062975e+001, -6.044056e+000},  // (-3,2/sin(pi/3))
+    {-9.881405e+001, +3.116914e+001},  // (-3,3/sin(pi/3))
+    {-1.390528e+002, +9.892534e+002},  // (-3,4/sin(pi/3))
+    {-4.123026e-001, +1.451806e-016},  // (-2,0)
+    {-1.034766e+000, +6.541962e-001},  // (-2,1/sin(pi/3))
+    {-2.720266e+000, +6.048328e+000},  // (-2,2/sin(pi/3))
+    {+2.096300e+001, +3.630613e+001},  // (-2,3/sin(pi/3))
+    {+3.090465e+002, -6.713963e+001},  // (-2,4/sin(pi/3))
+    {-4.664937e+002, -2.800165e+003},  // (-2,5/sin(pi/3))
+    {+1.039974e-001, +0.000000e+000},  // (-1,0)
+    {+2.797458e-001, +8.086491e-001},  // (-1,1/sin(pi/3))
+    {+2.606133e+000, +1.870297e+000},  // (-1,2/sin(pi/3))
+    {+1.292648e+001, -7.213647e+000},  // (-1,3/sin(pi/3))
+    {-3.208774e+001, -8.178697e+001},  // (-1,4/sin(pi/3))
+    {-5.692218e+002, +2.993394e+002},  // (-1,5/sin(pi/3))
+    {+6.149266e-001, +0.000000e+000},  // ( 0,0)
+    {+6.732023e-001, +3.575876e-001},  // ( 0,1/sin(pi/3))
+    {+1.125057e+000, -4.471292e-001},  // ( 0,2/sin(pi/3))
+    {-1.211148e+000, -4.191469e+000},  // ( 0,3/sin(pi/3))
+    {-1.960240e+001, +7.182663e+000},  // ( 0,4/sin(pi/3))
+    {+7.595175e+001, +1.012911e+002},  // ( 0,5/sin(pi/3))
+    {+1.207424e+000, +0.000000e+000},  // ( 1,0)
+    {+5.951440e-001, +6.156664e-001},  // ( 1,1/sin(pi/3))
+    {-1.002325e-001, -1.338228e-001},  // ( 1,2/sin(pi/3))
+    {-1.089323e+000, -2.019524e-001},  // ( 1,3/sin(pi/3))
+    {+7.047139e-001, +4.091592e+000},  // ( 1,4/sin(pi/3))
+    {+1.691067e+001, -1.302705e+001},  // ( 1,5/sin(pi/3))
+    {+3.298095e+000, +0.000000e+000},  // ( 2,0)
+    {+2.244706e-001, +2.421124e+000},  // ( 2,1/sin(pi/3))
+    {-1.199515e+000, -1.167656e-001},  // ( 2,2/sin(pi/3))
+    {+6.781072e-003, -2.225418e-001},  // ( 2,3/sin(pi/3))
+    {+7.470822e-001, +1.832986e-001},  // ( 2,4/sin(pi/3))
+    {-1.590993e+000, -2.617694e+000},  // ( 2,5/sin(pi/3))
+    {+1.403733e+001, +0.000000e+000},  // ( 3,0)
+    {-3.731398e+000, +1.066394e+001},  // ( 3,1/sin(pi/3))
+    {-4.440986e+000, -4.309647e+000},  // ( 3,2/sin(pi/3))
+    {+2.373933e+000, -5.300179e-001},  // ( 3,3/sin(pi/3))
+    {-2.821481e-001, +5.657373e-001},  // ( 3,4/sin(pi/3))
+    {-3.904913e-001, -5.168316e-002},  // ( 3,5/sin(pi/3))
+    {+8.384707e+001, +0.000000e+000},  // ( 4,0)
+    {-4.356467e+001, +5.497027e+001},  // ( 4,1/sin(pi/3))
+    {-7.156364e+000, -4.113550e+001},  // ( 4,2/sin(pi/3))
+    {+1.455852e+001, +1.109071e+001},  // ( 4,3/sin(pi/3))
+    {-6.111359e+000, -1.094609e-001},  // ( 4,4/sin(pi/3))
+    {+1.403434e+000, -7.255043e-001},  // ( 4,5/sin(pi/3))
+    {+6.577920e+002, +0.000000e+000},  // ( 5,0)
+    {-4.598656e+002, +3.242259e+002},  // ( 5,1/sin(pi/3))
+    {+1.324505e+002, -3.294705e+002},  // ( 5,2/sin(pi/3))
+    {+2.057579e+001, +1.674034e+002},  // ( 5,3/sin(pi/3))
+    {-3.161505e+001, -5.302141e+001},  // ( 5,4/sin(pi/3))
+    {+6.536446e+003, +0.000000e+000},  // ( 6,0)
+    {-5.316522e+003, +1.992175e+003},  // ( 6,1/sin(pi/3))
+    {+2.888529e+003, -2.373473e+003},  // ( 6,2/sin(pi/3))
+    {-1.078657e+003, +1.551931e+003},  // ( 6,3/sin(pi/3))
+    {+8.032779e+004, +0.000000e+000},  // ( 7,0)
+    {-7.001987e+004, +8.828416e+003},  // ( 7,1/sin(pi/3))
+    {+4.676699e+004, -1.085924e+004}   // ( 7,2/sin(pi/3))
+};
+
+//////////////////////////////////////////////////////////////
+
+// Complex array of the value Bi'(a) derivative of the Airy function
+// where a is the complex location of the center of expansion of the Taylor series
+// presumably for Ai'[z]
+constexpr std::complex<double> BPV[] = {
+    {-8.128988e-001, +3.365185e-016},  //    (-6,0)
+    {-6.287609e+000, +4.146176e+000},  //    (-6,1/sin(pi/3))
+    {+7.784118e-001, -3.004629e-016},  //    (-5,0)
+    {+5.554036e+000, +1.063645e+000},  //    (-5,1/sin(pi/3))
+    {+7.490659e+001, -2.336310e+001},  //    (-5,2/sin(pi/3))
+    {+5.670796e+002, -1.026488e+003},  //    (-5,3/sin(pi/3))
+    {-1.166706e-001, +2.371654e-015},  //    (-4,0)
+    {-1.532413e+000, -3.730947e+000},  //    (-4,1/sin(pi/3))
+    {-3.554558e+001, -2.608034e+001},  //    (-4,2/sin(pi/3))
+    {-5.124001e+002, +1.076185e+002},  //    (-4,3/sin(pi/3))
+    {-1.809619e+003, +6.659780e+003},  //    (-4,4/sin(pi/3))
+    {-6.756112e-001, -2.403703e-017},  //    (-3,0)
+    {-2.142202e+000, +1.818610e+000},  //    (-3,1/sin(pi/3))
+    {-4.863137e+000, +2.258023e+001},  //    (-3,2/sin(pi/3))
+    {+1.433564e+002, +1.616285e+002},  //    (-3,3/sin(pi/3))
+    {+2.152746e+003, -8.004716e+002},  //    (-3,4/sin(pi/3))
+    {+2.787952e-001, +0.000000e+000},  //    (-2,0)
+    {+1.300360e+000, +1.185229e+000},  //    (-2,1/sin(pi/3))
+    {+1.103082e+001, +1.397575e-001},  //    (-2,2/sin(pi/3))
+    {+4.048422e+001, -7.011484e+001},  //    (-2,3/sin(pi/3))
+    {-4.969277e+002, -4.831712e+002},  //    (-2,4/sin(pi/3))
+    {-4.862729e+003, +4.897066e+003},  //    (-2,5/sin(pi/3))
+    {+5.923756e-001, +0.000000e+000},  //    (-1,0)
+    {+9.080502e-001, -5.080757e-001},  //    (-1,1/sin(pi/3))
+    {+1.499485e-001, -4.631403e+000},  //    (-1,2/sin(pi/3))
+    {-2.494926e+001, -1.052676e+001},  //    (-1,3/sin(pi/3))
+    {-9.039663e+001, +1.633370e+002},  //    (-1,4/sin(pi/3))
+    {+1.424833e+003, +5.644943e+002},  //    (-1,5/sin(pi/3))
+    {+4.482884e-001, +0.000000e+000},  //    ( 0,0)
+    {+2.493288e-002, -1.876446e-001},  //    ( 0,1/sin(pi/3))
+    {-1.774795e+000, -3.533830e-001},  //    ( 0,2/sin(pi/3))
+    {-3.663891e+000, +7.026174e+000},  //    ( 0,3/sin(pi/3))
+    {+4.036322e+001, +1.773235e+001},  //    ( 0,4/sin(pi/3))
+    {+3.840990e+001, -2.979143e+002},  //    ( 0,5/sin(pi/3))
+    {+9.324359e-001, +0.000000e+000},  //    ( 1,0)
+    {-1.293870e-001, +7.817697e-001},  //    ( 1,1/sin(pi/3))
+    {-8.385825e-001, +4.901385e-001},  //    ( 1,2/sin(pi/3))
+    {+1.421331e+000, +1.181168e+000},  //    ( 1,3/sin(pi/3))
+    {+4.244380e+000, -7.895016e+000},  //    ( 1,4/sin(pi/3))
+    {-5.123410e+001, -1.383387e+000},  //    ( 1,5/sin(pi/3))
+    {+4.100682e+000, +0.000000e+000},  //    ( 2,0)
+    {-9.576171e-001, +3.432468e+000},  //    ( 2,1/sin(pi/3))
+    {-1.747487e+000, -8.602854e-001},  //    ( 2,2/sin(pi/3))
+    {+9.978890e-001, -6.434913e-001},  //    ( 2,3/sin(pi/3))
+    {-1.127841e+000, -7.762214e-001},  //    ( 2,4/sin(pi/3))
+    {-5.136144e-001, +7.476880e+000},  //    ( 2,5/sin(pi/3))
+    {+2.292221e+001, +0.000000e+000},  //    ( 3,0)
+    {-1.021000e+001, +1.662556e+001},  //    ( 3,1/sin(pi/3))
+    {-5.018884e+000, -1.067168e+001},  //    ( 3,2/sin(pi/3))
+    {+5.067979e+000, +1.074279e+000},  //    ( 3,3/sin(pi/3))
+    {-1.620678e+000, +1.029461e+000},  //    ( 3,4/sin(pi/3))
+    {+1.055970e+000, -2.041230e-001},  //    ( 3,5/sin(pi/3))
+    {+1.619267e+002, +0.000000e+000},  //    ( 4,0)
+    {-1.021827e+002, +9.434616e+001},  //    ( 4,1/sin(pi/3))
+    {+9.638391e+000, -8.764529e+001},  //    ( 4,2/sin(pi/3))
+    {+2.157904e+001, +3.568852e+001},  //    ( 4,3/sin(pi/3))
+    {-1.346647e+001, -6.665778e+000},  //    ( 4,4/sin(pi/3))
+    {+4.276735e+000, -9.657825e-002},  //    ( 4,5/sin(pi/3))
+    {+1.435819e+003, +0.000000e+000},  //    ( 5,0)
+    {-1.099383e+003, +5.897525e+002},  //    ( 5,1/sin(pi/3))
+    {+4.709887e+002, -6.717565e+002},  //    ( 5,2/sin(pi/3))
+    {-7.965464e+001, +4.040825e+002},  //    ( 5,3/sin(pi/3))
+    {-2.418965e+001, -1.582957e+002},  //    ( 5,4/sin(pi/3))
+    {+1.572560e+004, +0.000000e+000},  //    ( 6,0)
+    {-1.334470e+004, +3.525428e+003},  //    ( 6,1/sin(pi/3))
+    {+8.229089e+003, -4.446372e+003},  //    ( 6,2/sin(pi/3))
+    {-3.795705e+003, +3.141147e+003},  //    ( 6,3/sin(pi/3))
+    {+2.095527e+005, +0.000000e+000},  //    ( 7,0)
+    {-1.853403e+005, +7.452520e+003},  //    ( 7,1/sin(pi/3))
+    {+1.286235e+005, -8.069218e+003}   //    ( 7,2/sin(pi/3))
+};
+
+/*******************************************************************************
+ * Check that `kind` and `scaling` are valid arguments of `Airy()`.
+ *
+ * @param[in] kind     The type of Airy function to solve
+ * @param[in] scaling  Type of scaling to use
+ * @return             `SUCCESS`, or `ERROR__AIRY_ARGUMENT` if the values
+ *                     provided for `kind` or `scaling` are not valid for `Airy()`
+ ******************************************************************************/
+ReturnCode ValidateAiryArguments(
+    const AiryKind kind, const AiryScaling scaling
+) noexcept {
+    if ((kind != AiryKind::AIRY) && (kind != AiryKind::AIRYD)
+        && (kind != AiryKind::BAIRY) && (kind != AiryKind::BAIRYD)
+        && (kind != AiryKind::WONE) && (kind != AiryKind::DWONE)
+        && (kind != AiryKind::WTWO) && (kind != AiryKind::DWTWO))
+        return ERROR__AIRY_ARGUMENT;
+
+    if ((scaling != AiryScaling::NONE) && (scaling != AiryScaling::HUFFORD)
+        && (scaling != AiryScaling::WAIT))
+        return ERROR__AIRY_ARGUMENT;
+
+    // Airy functions of the third kind must have either HUFFORD or WAIT scaling
+    if (((kind == AiryKind::WONE) || (kind == AiryKind::WTWO)
+         || (kind == AiryKind::DWONE) || (kind == AiryKind::DWTWO))
+        && (scaling == AiryScaling::NONE))
+        return ERROR__AIRY_ARGUMENT;
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Check whether `kind` is the derivative of an Airy function.
+ *
+ * @param[in] kind  The type of Airy function to solve
+ * @return          True for `AIRYD`, `BAIRYD`, `DWONE`, and `DWTWO`
+ ******************************************************************************/
+bool IsAiryDerivative(const AiryKind kind) noexcept {
+    return kind == AiryKind::DWTWO || kind == AiryKind::DWONE
+        || kind == AiryKind::AIRYD || kind == AiryKind::BAIRYD;
+}
+
+/*******************************************************************************
+ * Report a failure of `TryAiry()` as the exception thrown by `Airy()`.
+ *
+ * When the library is built without exceptions, the message is instead
+ * printed to standard error and the program is aborted.
+ *
+ * @param[in] rtn      Return code of `TryAiry()`
+ * @param[in] kind     The type of Airy function to solve
+ * @param[in] scaling  Type of scaling to use
+ *
+ * @throws std::invalid_argument If `rtn` is `ERROR__AIRY_ARGUMENT`
+ * @throws std::range_error      If `rtn` is `ERROR__AIRY_RANGE`
+ ******************************************************************************/
+[[noreturn]] void ThrowAiryError(
+    const ReturnCode rtn, const AiryKind kind, const AiryScaling scaling
+) {
+    std::ostringstream oss;
+    if (rtn == ERROR__AIRY_RANGE) {
+        oss << "Airy(): Center of expansion index is out of range for "
+            << "internal Airy data array. Unable to proceed.";
+    } else if ((kind != AiryKind::AIRY) && (kind != AiryKind::AIRYD)
+               && (kind != AiryKind::BAIRY) && (kind != AiryKind::BAIRYD)
+               && (kind != AiryKind::WONE) && (kind != AiryKind::DWONE)
+               && (kind != AiryKind::WTWO) && (kind != AiryKind::DWTWO)) {
+        oss << "Airy(): `kind` must be one of `AIRY` ("
+            << static_cast<int>(AiryKind::AIRY) << "), `AIRYD` ("
+            << static_cast<int>(AiryKind::AIRYD) << "), `BAIRY` ("
+            << static_cast<int>(AiryKind::BAIRY) << "), `BAIRYD` ("
+            << static_cast<int>(AiryKind::BAIRYD) << "), `WONE` ("
+            << static_cast<int>(AiryKind::WONE) << "), `DWONE` ("
+            << static_cast<int>(AiryKind::DWONE) << "), `WTWO` ("
+            << static_cast<int>(AiryKind::WTWO) << "), `DWTWO` ("
+            << static_cast<int>(AiryKind::DWTWO) << "), not "
+            << static_cast<int>(kind);
+    } else if (((kind == AiryKind::WONE) || (kind == AiryKind::WTWO)
+                || (kind == AiryKind::DWONE) || (kind == AiryKind::DWTWO))
+               && ((scaling != AiryScaling::HUFFORD)
+                   && (scaling != AiryScaling::WAIT))) {
+        oss << "Airy(): When solving an Airy function of the third kind, "
+               "`scaling` must be one of `HUFFORD` ("
+            << static_cast<int>(AiryScaling::HUFFORD) << ") or `WAIT` ("
+            << static_cast<int>(AiryScaling::WAIT) << "), not "
+            << static_cast<int>(scaling);
+    } else {
+        oss << "Airy(): `scaling` must be one of `NONE` ("
+            << static_cast<int>(AiryScaling::NONE) << "), `HUFFORD` ("
+            << static_cast<int>(AiryScaling::HUFFORD) << "), `WAIT` ("
+            << static_cast<int>(AiryScaling::WAIT) << "), not "
+            << static_cast<int>(scaling);
+    }
+
+#ifdef LFMF_NO_EXCEPTIONS
+    std::fprintf(stderr, "%s\n", oss.str().c_str());
+    std::abort();
+#else
+    if (rtn == ERROR__AIRY_RANGE)
+        throw std::range_error(oss.str());
+    throw std::invalid_argument(oss.str());
+#endif
+}
+
+/*******************************************************************************
+ * Rotation applied to the argument of `Airy()` before Ai(Z) or Bi(Z) is
+ * evaluated.
+ *
+ * @param[in] kind     The type of Airy function to solve
+ * @param[in] scaling  Type of scaling to use
+ * @return             Multiplier of the argument
+ ******************************************************************************/
+std::complex<double> AiryRotation(
+    const AiryKind kind, const AiryScaling scaling
+) {
+    std::complex<double> U;
+    if (kind == AiryKind::AIRY || kind == AiryKind::BAIRY
+        || kind == AiryKind::AIRYD || kind == AiryKind::BAIRYD) {
+        // For Ai(Z) and  Bi(Z) No translation in the complex plane
+        U = std::complex<double>(1.0, 0.0);
+    }
+    // Note that W1 Wait = Wi(2) Hufford and W2 Wait = Wi(1) Hufford
+    // So the following inequalities keep this all straight
+    else if (((kind == AiryKind::DWONE || kind == AiryKind::WONE)
+              && scaling == AiryScaling::HUFFORD)
+             || ((kind == AiryKind::DWTWO || kind == AiryKind::WTWO)
+                 && scaling == AiryScaling::WAIT)) {
+        // This corresponds to Wi(1)(Z) in Eqn 38 Hufford NTIA Report 87-219
+        // or Wait W2
+        U = std::complex<double>(
+            std::cos(2.0 * PI / 3.0), std::sin(2.0 * PI / 3.0)
+        );
+    } else if (((kind == AiryKind::DWTWO || kind == AiryKind::WTWO)
+                && scaling == AiryScaling::HUFFORD)
+               || ((kind == AiryKind::DWONE || kind == AiryKind::WONE)
+                   && scaling == AiryScaling::WAIT)) {
+        // This corresponds to Wi(2)(Z) in Eqn 38 Hufford NTIA Report 87-219
+        // or Wait W1
+        U = std::complex<double>(
+            std::cos(-2.0 * PI / 3.0), std::sin(-2.0 * PI / 3.0)
+        );
+    };
+
+    return U;
+}
+
+/*******************************************************************************
+ * Scaling applied to Ai(Z) or Bi(Z) to obtain the result of `Airy()`.
+ *
+ * @param[in] kind             The type of Airy function to solve
+ * @param[in] scaling          Type of scaling to use
+ * @param[in] derivative_flag  True if finding a derivative (e.g., Ai', Bi')
+ * @return                     Multiplier of the result
+ ******************************************************************************/
+std::complex<double> AiryScaleFactor(
+    const AiryKind kind, const AiryScaling scaling, const bool derivative_flag
+) {
+    // Ai(Z) and Bi(Z) are not scaled
+    std::complex<double> U(1.0, 0.0);
+
+    // The final scaling factor is a function of the kind, derivative and scaling flags
+    // Hufford Wi(1) and Wi'(1)
+    if ((kind == AiryKind::WONE || kind == AiryKind::DWONE)
+        && (scaling == AiryScaling::HUFFORD)) {
+        if (derivative_flag) {
+            U = 2.0
+              * std::complex<double>(std::cos(PI / 3.0), std::sin(PI / 3.0));
+        } else {
+            U = 2.0
+              * std::complex<double>(std::cos(-PI / 3.0), std::sin(-PI / 3.0));
+        };
+    }
+    // Hufford Wi(2) and Wi'(2)
+    else if ((kind == AiryKind::WTWO || kind == AiryKind::DWTWO)
+             && (scaling == AiryScaling::HUFFORD)) {
+        if (derivative_flag) {
+            U = 2.0
+              * std::complex<double>(std::cos(-PI / 3.0), std::sin(-PI / 3.0));
+        } else {
+            U = 2.0
+              * std::complex<double>(std::cos(PI / 3.0), std::sin(PI / 3.0));
+        };
+    }
+    // Wait W1 and W1'
+    else if ((kind == AiryKind::WONE || kind == AiryKind::DWONE)
+             && (scaling == AiryScaling::WAIT)) {
+        if (derivative_flag) {
+            U = std::complex<double>(
+                -1.0 * std::sqrt(3.0 * PI), -1.0 * std::sqrt(PI)
+            );
+        } else {
+            U = std::complex<double>(std::sqrt(3.0 * PI), -1.0 * std::sqrt(PI));
+        };
+    }
+    // Wait W2 and W2'
+    else if ((kind == AiryKind::WTWO || kind == AiryKind::DWTWO)
+             && (scaling == AiryScaling::WAIT)) {
+        if (derivative_flag) {
+            U = std::complex<double>(-1.0 * std::sqrt(3.0 * PI), std::sqrt(PI));
+        } else {
+            U = std::complex<double>(std::sqrt(3.0 * PI), std::sqrt(PI));
+        };
+    };
+
+    return U;
+}
+
+/** Number of arguments evaluated together by the batch `Airy()` */
+constexpr std::size_t AIRY_LANES = 8;
+
+/** Number of arguments sorted together by the batch `Airy()` */
+constexpr std::size_t AIRY_CHUNK = 512;
+
+/*******************************************************************************
+ * Sum the shifted Taylor series of the batch `Airy()` for a group of
+ * arguments which share one center of expansion, in blocks of `AIRY_LANES`.
+ *
+ * Each lane performs the operations of the scalar `Airy()` in the same order,
+ * and its result is taken after the same number of terms. Lanes which have
+ * converged keep taking terms until the whole block has, so the loop taking a
+ * term has no branches.
+ *
+ * @param[in]     n_idx           Number of arguments in the group
+ * @param[in]     idx             Indices of the arguments in the group
+ * @param[in]     N               Index of the center of expansion
+ * @param[in]     CoE             Center of expansion
+ * @param[in]     bairy           True for Bi(Z) and Bi'(Z), false for Ai(Z)
+ * @param[in]     derivative_idx  1 if finding a derivative, otherwise 0
+ * @param[in,out] ZU              Arguments, reflected into quadrants 1 and 2;
+ *                                on return, the function value at each index
+ *                                of the group
+ ******************************************************************************/
+void AiryTaylorLanes(
+    const std::size_t n_idx,
+    const std::size_t *idx,
+    const int N,
+    const std::complex<double> CoE,
+    const bool bairy,
+    const int derivative_idx,
+    std::complex<double> *ZU
+) {
+    constexpr std::size_t L = AIRY_LANES;
+
+    // Ai or Bi, and its derivative, at the center of expansion
+    const std::complex<double> Ai = bairy ? BV[N - 1] : AV[N - 1];
+    const std::complex<double> Aip = bairy ? BPV[N - 1] : APV[N - 1];
+    const std::complex<double> AiCoE = Ai * CoE;
+
+    alignas(64) double z_re[L], z_im[L], AN[L];
+    alignas(64) double A0_re[L], A0_im[L], A1_re[L], A1_im[L];
+    alignas(64) double B1_re[L], B1_im[L];
+    alignas(64) double B2_re[L], B2_im[L], B3_re[L], B3_im[L];
+    int cnt[L];  // Number of times each lane has converged
+
+    for (std::size_t b = 0; b < n_idx; b += L) {
+        const std::size_t m = std::min(L, n_idx - b);
+
+        // Find the first elements of the Taylor series, as in `Airy()`
+        for (std::size_t l = 0; l < L; l++) {
+            const std::complex<double> z
+                = (l < m) ? ZU[idx[b + l]] - CoE : std::complex<double>();
+            const std::complex<double> B3 = AiCoE * z;
+            const std::complex<double> B2 = Aip * z;
+            const std::complex<double> A0 = B2 + Ai;
+            const std::complex<double> A1 = Aip + B3;
+            z_re[l] = z.real();
+            z_im[l] = z.imag();
+            B1_re[l] = Ai.real();
+            B1_im[l] = Ai.imag();
+            B2_re[l] = B2.real();
+            B2_im[l] = B2.imag();
+            B3_re[l] = B3.real();
+            B3_im[l] = B3.imag();
+            A0_re[l] = A0.real();
+            A0_im[l] = A0.imag();
+            A1_re[l] = A1.real();
+            A1_im[l] = A1.imag();
+            AN[l] = 1.0;
+            cnt[l] = (l < m) ? 0 : 3;  // Unused lanes are already done
+        }
+
+        // Compute terms of the series until each lane has converged 3 times
+        std::size_t n_active = m;
+        while (n_active > 0) {
+            // Every lane takes the next term, including lanes which have
+            // already converged, so that the loop has no branches
+            for (std::size_t l = 0; l < L; l++) {
+                const double an = AN[l] + 1.0;
+                const double zr = z_re[l];
+                const double zi = z_im[l];
+                // B3 = B3 * ZU / AN
+                const double t3_re = (B3_re[l] * zr - B3_im[l] * zi) / an;
+                const double t3_im = (B3_re[l] * zi + B3_im[l] * zr) / an;
+                // B3 = (CoE * B1 + ZU * B0) * ZU / AN, with B1 = B2, B0 = B1
+                const double s_re
+                    = (CoE.real() * B2_re[l] - CoE.imag() * B2_im[l])
+                    + (zr * B1_re[l] - zi * B1_im[l]);
+                const double s_im
+                    = (CoE.real() * B2_im[l] + CoE.imag() * B2_re[l])
+                    + (zr * B1_im[l] + zi * B1_re[l]);
+                const double u3_re = (s_re * zr - s_im * zi) / an;
+                const double u3_im = (s_re * zi + s_im * zr) / an;
+
+                AN[l] = an;
+                A0_re[l] = t3_re + A0_re[l];
+                A0_im[l] = t3_im + A0_im[l];
+                B1_re[l] = B2_re[l];
+                B1_im[l] = B2_im[l];
+                B2_re[l] = t3_re;
+                B2_im[l] = t3_im;
+                B3_re[l] = u3_re;
+                B3_im[l] = u3_im;
+                A1_re[l] = u3_re + A1_re[l];
+                A1_im[l] = u3_im + A1_im[l];
+            }
+
+            // Has the convergence criteria been met? A lane's result is taken
+            // when it converges for the third time, as in `Airy()`
+            for (std::size_t l = 0; l < m; l++) {
+                if (cnt[l] >= 3)
+                    continue;
+                if (!((std::hypot(B2_re[l], B2_im[l])
+                       > (0.5E-7 * std::hypot(A0_re[l], A0_im[l])))
+                      || (std::hypot(B3_re[l], B3_im[l])
+                          > (0.5E-7 * std::hypot(A1_re[l], A1_im[l]))))) {
+                    if (++cnt[l] == 3) {
+                        n_active--;
+                        ZU[idx[b + l]]
+                            = (derivative_idx == 0)
+                                ? std::complex<double>(A0_re[l], A0_im[l])
+                                : std::complex<double>(A1_re[l], A1_im[l]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Divide complex numbers held as separate real and imaginary parts.
+ *
+ * Uses Smith's algorithm, as the compiler runtime does for `std::complex`
+ * division, without its rescaling of operands near overflow or underflow.
+ * The operands are selected before dividing, rather than dividing in one of
+ * two branches, so that a loop over lanes stays branch free.
+ *
+ * @param[in]  a      Real part of the numerator
+ * @param[in]  b      Imaginary part of the numerator
+ * @param[in]  c      Real part of the denominator
+ * @param[in]  d      Imaginary part of the denominator
+ * @param[out] x      Real part of the quotient
+ * @param[out] y      Imaginary part of the quotient
+ ******************************************************************************/
+inline void LaneDivide(
+    const double a,
+    const double b,
+    const double c,
+    const double d,
+    double &x,
+    double &y
+) {
+    const bool d_larger = (std::abs(c) < std::abs(d));
+
+    // Divide by the larger part of the denominator, as Smith's algorithm does
+    const double big = d_larger ? d : c;
+    const double small = d_larger ? c : d;
+    const double first = d_larger ? a : b;
+    const double second = d_larger ? b : a;
+    const double sign = d_larger ? 1.0 : -1.0;
+
+    const double ratio = small / big;
+    const double denom = (small * ratio) + big;
+    x = ((first * ratio) + second) / denom;
+    y = sign * ((second * ratio) - first) / denom;
+}
+
+/*******************************************************************************
+ * Sum the asymptotic series of the batch `Airy()` for a group of arguments,
+ * in blocks of `AIRY_LANES`.
+ *
+ * Complex division is done by `LaneDivide()`, which rounds as the scalar
+ * `Airy()` does for arguments of ordinary magnitude. The loop summing the
+ * series has a fixed number of terms and no branches; the leading factors are
+ * then applied one lane at a time.
+ *
+ * @param[in]     n_idx           Number of arguments in the group
+ * @param[in]     idx             Indices of the arguments in the group
+ * @param[in]     bairy           True for Bi(Z) and Bi'(Z), false for Ai(Z)
+ * @param[in]     derivative_idx  1 if finding a derivative, otherwise 0
+ * @param[in,out] ZU              Arguments, reflected into quadrants 1 and 2;
+ *                                on return, the function value at each index
+ *                                of the group
+ ******************************************************************************/
+void AiryAsymptoticLanes(
+    const std::size_t n_idx,
+    const std::size_t *idx,
+    const bool bairy,
+    const int derivative_idx,
+    std::complex<double> *ZU
+) {
+    constexpr std::size_t L = AIRY_LANES;
+
+    // Terms of the series, signed for the Airy or Bairy sum
+    double C1[SIZE_OF_ASV], C2[SIZE_OF_ASV];
+    for (int i = 0; i < SIZE_OF_ASV; i++) {
+        const double one = (bairy || i % 2 == 0) ? 1.0 : -1.0;
+        C1[i] = (i < SIZE_OF_ASV - 1) ? one * ASV[i][derivative_idx]
+                                      : ASV[i][derivative_idx];
+        C2[i] = ASV[i][derivative_idx];
+    }
+
+    alignas(64) double ZT_re[L], ZT_im[L];
+    alignas(64) double S1_re[L], S1_im[L], S2_re[L], S2_im[L];
+    std::complex<double> ZT[L];
+
+    for (std::size_t b = 0; b < n_idx; b += L) {
+        const std::size_t m = std::min(L, n_idx - b);
+
+        for (std::size_t l = 0; l < L; l++) {
+            if (l < m) {
+                const std::complex<double> ZA = std::sqrt(ZU[idx[b + l]]);
+                ZT[l] = (2.0 / 3.0) * ZU[idx[b + l]] * ZA;
+            } else {
+                ZT[l] = 1.0;
+            }
+            ZT_re[l] = ZT[l].real();
+            ZT_im[l] = ZT[l].imag();
+            S1_re[l] = S1_im[l] = S2_re[l] = S2_im[l] = 0.0;
+        }
+
+        // sum = (ASV[i] + sum) / ZT, backward through the coefficients
+        for (int i = 0; i < SIZE_OF_ASV - 1; i++) {
+            for (std::size_t l = 0; l < L; l++) {
+                const double zr = ZT_re[l];
+                const double zi = ZT_im[l];
+                LaneDivide(
+                    C1[i] + S1_re[l], S1_im[l], zr, zi, S1_re[l], S1_im[l]
+                );
+                LaneDivide(
+                    C2[i] + S2_re[l], S2_im[l], zr, zi, S2_re[l], S2_im[l]
+                );
+            }
+        }
+
+        for (std::size_t l = 0; l < m; l++) {
+            const std::complex<double> Z = ZU[idx[b + l]];
+            const std::complex<double> ZA = std::sqrt(Z);
+
+            // Add the first element that is a function of zeta^0
+            const std::complex<double> sum1 = C1[SIZE_OF_ASV - 1]
+                + std::complex<double>(S1_re[l], S1_im[l]);
+
+            // The second series is only needed for phase(z) > PI/3
+            std::complex<double> sum2(0.0, 0.0);
+            if (std::abs(std::arg(Z)) > PI / 3.0)
+                sum2 = C2[SIZE_OF_ASV - 1]
+                     + std::complex<double>(S2_re[l], S2_im[l]);
+
+            std::complex<double> ZB, ZB1, ZB2;
+            if (bairy) {
+                ZB = (derivative_idx == 1) ? std::sqrt(ZA)
+                                           : 1.0 / (std::sqrt(ZA));
+                ZB1 = ZB * std::exp(ZT[l]) / std::sqrt(PI);
+                ZB2 = ZB * 1.0 / (std::exp(ZT[l]) * std::sqrt(PI));
+            } else {
+                ZB = (derivative_idx == 1) ? -1.0 * std::sqrt(ZA)
+                                           : 1.0 / std::sqrt(ZA);
+                ZB1 = ZB * 1.0 / (2.0 * std::exp(ZT[l]) * std::sqrt(PI));
+                ZB2 = ZB * std::exp(ZT[l]) / (2.0 * std::sqrt(PI));
+            }
+
+            if (derivative_idx == 1)
+                ZU[idx[b + l]]
+                    = ZB1 * sum1 - std::complex<double>(0.0, 1.0) * ZB2 * sum2;
+            else
+                ZU[idx[b + l]]
+                    = ZB1 * sum1 + std::complex<double>(0.0, 1.0) * ZB2 * sum2;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Choose the center of expansion of the shifted Taylor series of `Airy()` for
+ * an argument, as `Airy()` does.
+ *
+ * @param[in]  ZU   Argument, rotated and reflected into quadrants 1 and 2
+ * @param[out] N    Index of the center of expansion, or 0 if the argument is
+ *                  outside of the Taylor series region
+ * @param[out] NQ8  Index of the next real center of expansion, or 0
+ * @param[out] CoE  Center of expansion, if `N` < `NQ8`
+ * @return          `SUCCESS`, or `ERROR__AIRY_RANGE` if the center is past
+ *                  the end of the expansion data
+ ******************************************************************************/
+ReturnCode AiryCenter(
+    const std::complex<double> ZU,
+    int &N,
+    int &NQ8,
+    std::complex<double> &CoE
+) {
+    N = 0;
+    NQ8 = 0;
+    if ((ZU.real() >= -6.5) && (ZU.real() <= 7.5) && (ZU.imag() <= 6.35)) {
+        const int CoERealidx
+            = static_cast<int>(ZU.real() + std::copysign(0.5, ZU.real()));
+        const int CoEImagidx
+            = static_cast<int>(std::sin(PI / 3.0) * (ZU.imag() + 0.5));
+
+        N = NQTT[CoERealidx + 6] + CoEImagidx;
+        if (N >= 70)
+            return ERROR__AIRY_RANGE;
+        NQ8 = NQTT[CoERealidx + 7];
+
+        // An index past the next real center belongs to another center
+        if (N < NQ8) {
+            CoE = std::complex<double>(
+                static_cast<double>(CoERealidx),
+                static_cast<double>(CoEImagidx) / std::sin(PI / 3.0)
+            );
+        }
+    }
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Evaluate the batch `TryAiry()` for up to `AIRY_CHUNK` arguments, whose
+ * centers of expansion are known to be in range.
+ *
+ * The arguments are sorted by method and center of expansion into arrays on
+ * the stack, so that no memory is allocated.
+ *
+ * @param[in]  n               Number of arguments, at most `AIRY_CHUNK`
+ * @param[in]  Z               Complex input arguments
+ * @param[in]  U               Rotation of the arguments, from `AiryRotation()`
+ * @param[in]  scale           Scale factor, from `AiryScaleFactor()`
+ * @param[in]  bairy           True for Bi(Z) and Bi'(Z), false for Ai(Z)
+ * @param[in]  derivative_idx  1 if finding a derivative, otherwise 0
+ * @param[out] Ai              The function calculated at each argument
+ ******************************************************************************/
+void AiryChunk(
+    const std::size_t n,
+    const std::complex<double> *Z,
+    const std::complex<double> U,
+    const std::complex<double> scale,
+    const bool bairy,
+    const int derivative_idx,
+    std::complex<double> *Ai
+) {
+    std::complex<double> ZU[AIRY_CHUNK];  // Arguments, then results
+    bool reflection[AIRY_CHUNK];
+    int group[AIRY_CHUNK];          // N of the Taylor series, or 0 if none
+    std::size_t order[AIRY_CHUNK];  // Indices of arguments, sorted by group
+    std::size_t first[71] = {};     // Start of each group in `order`
+    std::complex<double> CoE[70];   // Center of expansion of each N
+
+    for (std::size_t i = 0; i < n; i++) {
+        // Translate the input parameter, and reflect it into quadrants 1 and 2
+        ZU[i] = Z[i] * U;
+        reflection[i] = (ZU[i].imag() <= 0);
+        if (reflection[i])
+            ZU[i] = std::complex<double>(ZU[i].real(), -ZU[i].imag());
+
+        // Choose the method as in `Airy()`
+        int N, NQ8;
+        std::complex<double> center(0.0, 0.0);
+        AiryCenter(ZU[i], N, NQ8, center);
+        if (N < NQ8)
+            CoE[N] = center;
+
+        if (AlmostEqualRelative(Z[i].real(), 0.0)
+            && AlmostEqualRelative(Z[i].imag(), 0.0)) {
+            // At the origin, `Airy()` overwrites the Taylor series with the
+            // asymptotic series, at the translated argument
+            ZU[i] -= center;
+            group[i] = 0;
+        } else {
+            group[i] = (N < NQ8) ? N : 0;
+        }
+        first[group[i] + 1]++;
+    }
+
+    // Sort the arguments by group
+    for (int N = 0; N < 70; N++)
+        first[N + 1] += first[N];
+    std::size_t next[70];
+    for (int N = 0; N < 70; N++)
+        next[N] = first[N];
+    for (std::size_t i = 0; i < n; i++)
+        order[next[group[i]]++] = i;
+
+    for (int N = 1; N < 70; N++) {
+        if (first[N + 1] > first[N]) {
+            AiryTaylorLanes(
+                first[N + 1] - first[N],
+                &order[first[N]],
+                N,
+                CoE[N],
+                bairy,
+                derivative_idx,
+                ZU
+            );
+        }
+    }
+    AiryAsymptoticLanes(first[1], order, bairy, derivative_idx, ZU);
+
+    // Final transform and scaling, as in `Airy()`
+    for (std::size_t i = 0; i < n; i++) {
+        std::complex<double> A = ZU[i];
+        if (reflection[i])
+            A = std::complex<double>(A.real(), -A.imag());
+        Ai[i] = A * scale;
+    }
+}
+
+}  // namespace
+
 /*******************************************************************************
  * Finds the functions and their derivatives for Airy functions of the first,
  * second, and third (following Hufford) kind.
@@ -45,6 +1012,9 @@ namespace LFMF {
  *                               functions of the third kind.
  * @throws std::range_error      If the calculation requires expansion data
  *                               outside the range of what is known by this program.
+ *                               In a library built without exceptions, these
+ *                               failures abort the program instead; `TryAiry()`
+ *                               reports them by return code.
  *
  * @note The following is a note on scaling the output from this program.
  *
@@ -129,417 +1099,61 @@ namespace LFMF {
 std::complex<double> Airy(
     const std::complex<double> Z, const AiryKind kind, const AiryScaling scaling
 ) {
-    // Centers of Expansion of Taylor series on real axis indices into the AV,
-    // APV, BV, and BPV arrays
-    constexpr int NQTT[15]
-        = {1, 3, 7, 12, 17, 23, 29, 35, 41, 47, 53, 59, 64, 68, 71};
-
-    std::complex<double> A[2], ZT, B0, B1, B2, B3, AN, U, ZA, ZB, ZU;  // Temps
-
-    // Ai is either Ai() or Bi() at the center of expansion of the Taylor series
     std::complex<double> Ai;
+    const ReturnCode rtn = TryAiry(Z, kind, scaling, Ai);
+    if (rtn != SUCCESS)
+        ThrowAiryError(rtn, kind, scaling);
+    return Ai;
+}
 
-    // terms for asymptotic series. second column is for derivative
-    constexpr int SIZE_OF_ASV = 15;
-    constexpr double ASV[SIZE_OF_ASV][2]
-        = {{0.5989251E+5, -0.6133571E+5},
-           {0.9207207E+4, -0.9446355E+4},
-           {0.1533169E+4, -0.1576357E+4},
-           {0.2784651E+3, -0.2870332E+3},
-           {0.5562279E+2, -0.5750830E+2},
-           {0.1234157E+2, -0.1280729E+2},
-           {0.3079453E+1, -0.3210494E+1},
-           {0.8776670E+0, -0.9204800E+0},
-           {0.2915914E+0, -0.3082538E+0},
-           {0.1160991E+0, -0.1241059E+0},
-           {0.5764919E-1, -0.6266216E-1},
-           {0.3799306E-1, -0.4246283E-1},
-           {0.3713349E-1, -0.4388503E-1},
-           {0.6944444E-1, -0.9722222E-1},
-           {0.1000000E+1, 0.1000000E+1}};
-
-    //////////////////////////////////////////////////////////////////////////
-    // Initialize the center of expansion arrays.                           //
-    //////////////////////////////////////////////////////////////////////////
-    // The array AV[] (and BV[]) is the Airy function for Ai(a) to shift    //
-    // the Taylor series from the origin to the point a Thus the series is  //
-    // f(z -a)                                                              //
-    // Why George Hufford choose these particular locations for the         //
-    // of the centers of expansion is unknown. The centers of expansion are //
-    // included here to remove any ambiguity in the method.                 //
-    //////////////////////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////   Center of expansion
-    ///////////////////////////////////////////////////   ( Real, Imaginary)
-
-    // Complex array of the value Ai(a) Airy function
-    // where a is the complex location of the center of expansion of the Taylor series
-    constexpr std::complex<double> AV[] = {
-        {-3.2914520e-001, +0.0000000e+000},  //   (-6,0)
-        {-2.6780040e+000, +1.4774590e+000},  //   (-6,1/sin(pi/3))
-        {+3.5076100e-001, +0.0000000e+000},  //   (-5,0)
-        {+2.4122260e+000, +6.9865120e-001},  //   (-5,1/sin(pi/3))
-        {+3.3635530e+001, -3.4600960e+000},  //   (-5,2/sin(pi/3))
-        {+3.4449740e+002, -3.3690890e+002},  //   (-5,3/sin(pi/3))
-        {-7.0265530e-002, +0.0000000e+000},  //   (-4,0)
-        {-5.4818220e-001, -1.9207370e+000},  //   (-4,1/sin(pi/3))
-        {-1.3383400e+001, -1.6022590e+001},  //   (-4,2/sin(pi/3))
-        {-2.2967800e+002, -3.2072450e+001},  //   (-4,3/sin(pi/3))
-        {-1.8040780e+003, +2.1917680e+003},  //   (-4,4/sin(pi/3))
-        {-3.7881430e-001, +0.0000000e+000},  //   (-3,0)
-        {-1.3491840e+000, +8.4969080e-001},  //   (-3,1/sin(pi/3))
-        {-6.0453340e+000, +1.0623180e+001},  //   (-3,2/sin(pi/3))
-        {+3.1169620e+001, +9.8813520e+001},  //   (-3,3/sin(pi/3))
-        {+9.8925350e+002, +1.3905290e+002},  //   (-3,4/sin(pi/3))
-        {+2.2740740e-001, +0.0000000e+000},  //   (-2,0)
-        {+7.1857400e-001, +9.7809090e-001},  //   (-2,1/sin(pi/3))
-        {+6.0621090e+000, +2.7203010e+000},  //   (-2,2/sin(pi/3))
-        {+3.6307080e+001, -2.0961360e+001},  //   (-2,3/sin(pi/3))
-        {-6.7139790e+001, -3.0904640e+002},  //   (-2,4/sin(pi/3))
-        {-2.8001650e+003, +4.6649370e+002},  //   (-2,5/sin(pi/3))
-        {+5.3556090e-001, +0.0000000e+000},  //   (-1,0)
-        {+9.2407370e-001, -1.9106560e-001},  //   (-1,1/sin(pi/3))
-        {+1.8716190e+000, -2.5743310e+000},  //   (-1,2/sin(pi/3))
-        {-7.2188440e+000, -1.2924200e+001},  //   (-1,3/sin(pi/3))
-        {-8.1787380e+001, +3.2087010e+001},  //   (-1,4/sin(pi/3))
-        {+2.9933950e+002, +5.6922180e+002},  //   (-1,5/sin(pi/3))
-        {+3.5502810e-001, +0.0000000e+000},  //   ( 0,0)
-        {+3.1203440e-001, -3.8845390e-001},  //   ( 0,1/sin(pi/3))
-        {-5.2840000e-001, -1.0976410e+000},  //   ( 0,2/sin(pi/3))
-        {-4.2009350e+000, +1.1940150e+000},  //   ( 0,3/sin(pi/3))
-        {+7.1858830e+000, +1.9600910e+001},  //   ( 0,4/sin(pi/3))
-        {+1.0129120e+002, -7.5951230e+001},  //   ( 0,5/sin(pi/3))
-        {+1.3529240e-001, +0.0000000e+000},  //   ( 1,0)
-        {+3.2618480e-002, -1.7084870e-001},  //   ( 1,1/sin(pi/3))
-        {-3.4215380e-001, -8.9067650e-002},  //   ( 1,2/sin(pi/3))
-        {-1.4509640e-001, +1.0328020e+000},  //   ( 1,3/sin(pi/3))
-        {+4.1001970e+000, -6.8936910e-001},  //   ( 1,4/sin(pi/3))
-        {-1.3030120e+001, -1.6910540e+001},  //   ( 1,5/sin(pi/3))
-        {+3.4924130e-002, +0.0000000e+000},  //   ( 2,0)
-        {-8.4464730e-003, -4.2045150e-002},  //   ( 2,1/sin(pi/3))
-        {-6.9313270e-002, +3.5364800e-002},  //   ( 2,2/sin(pi/3))
-        {+1.5227620e-001, +1.2848450e-001},  //   ( 2,3/sin(pi/3))
-        {+1.0681370e-001, -6.7766150e-001},  //   ( 2,4/sin(pi/3))
-        {-2.6193430e+000, +1.5699860e+000},  //   ( 2,5/sin(pi/3))
-        {+6.5911390e-003, +0.0000000e+000},  //   ( 3,0)
-        {-3.9443990e-003, -6.8060110e-003},  //   ( 3,1/sin(pi/3))
-        {-5.9820130e-003, +1.1799010e-002},  //   ( 3,2/sin(pi/3))
-        {+2.9922500e-002, -5.9772930e-003},  //   ( 3,3/sin(pi/3))
-        {-7.7464130e-002, -5.2292400e-002},  //   ( 3,4/sin(pi/3))
-        {+1.1276590e-001, +3.5112440e-001},  //   ( 3,5/sin(pi/3))
-        {+9.5156390e-004, +0.0000000e+000},  //   ( 4,0)
-        {-8.0843000e-004, -7.6590130e-004},  //   ( 4,1/sin(pi/3))
-        {+1.6147820e-004, +1.7661760e-003},  //   ( 4,2/sin(pi/3))
-        {+2.0138720e-003, -3.1976720e-003},  //   ( 4,3/sin(pi/3))
-        {-9.5086780e-003, +4.5377830e-003},  //   ( 4,4/sin(pi/3))
-        {+3.7560190e-002, +5.7361920e-004},  //   ( 4,5/sin(pi/3))
-        {+1.0834440e-004, +0.0000000e+000},  //   ( 5,0)
-        {-1.0968610e-004, -5.9902330e-005},  //   ( 5,1/sin(pi/3))
-        {+1.0778190e-004, +1.5771600e-004},  //   ( 5,2/sin(pi/3))
-        {-6.8980940e-005, -3.7626460e-004},  //   ( 5,3/sin(pi/3))
-        {-1.6166130e-004, +9.7457770e-004},  //   ( 5,4/sin(pi/3))
-        {+9.9476940e-006, +0.0000000e+000},  //   ( 6,0)
-        {-1.0956820e-005, -2.9508800e-006},  //   ( 6,1/sin(pi/3))
-        {+1.4709070e-005, +8.1042090e-006},  //   ( 6,2/sin(pi/3))
-        {-2.4446020e-005, -2.0638140e-005},  //   ( 6,3/sin(pi/3))
-        {+7.4921290e-007, +0.0000000e+000},  //   ( 7,0)
-        {-8.4619070e-007, -3.6807340e-008},  //   ( 7,1/sin(pi/3))
-        {+1.2183960e-006, +8.3589200e-008}   //   ( 7,2/sin(pi/3))
-    };
-    //////////////////////////////////////////////////////////////////////////
-    // This array APV[] is the derivative of the Airy function for Ai'(a)   //
-    //////////////////////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////   Center of expansion
-    ///////////////////////////////////////////////////   ( Real, Imaginary)
-    // Complex array of the value Ai'(a) derivative of the Airy function
-    // where a is the complex location of the center of expansion of the Taylor series
-    // presumably for Ai'[z]
-    constexpr std::complex<double> APV[] = {
-        {+3.4593550e-001, +0.0000000e+000},  //  (-6,0)
-        {+4.1708880e+000, +6.2414440e+000},  //  (-6,1/sin(pi/3))
-        {+3.2719280e-001, +0.0000000e+000},  //  (-5,0)
-        {+1.0828740e+000, -5.4928300e+000},  //  (-5,1/sin(pi/3))
-        {-2.3363520e+001, -7.4901850e+001},  //  (-5,2/sin(pi/3))
-        {-1.0264880e+003, -5.6707940e+002},  //  (-5,3/sin(pi/3))
-        {-7.9062860e-001, +0.0000000e+000},  //  (-4,0)
-        {-3.8085830e+000, +1.5129610e+000},  //  (-4,1/sin(pi/3))
-        {-2.6086380e+001, +3.5540710e+001},  //  (-4,2/sin(pi/3))
-        {+1.0761840e+002, +5.1239940e+002},  //  (-4,3/sin(pi/3))
-        {+6.6597800e+003, +1.8096190e+003},  //  (-4,4/sin(pi/3))
-        {+3.1458380e-001, +0.0000000e+000},  //  (-3,0)
-        {+1.8715430e+000, +2.0544840e+000},  //  (-3,1/sin(pi/3))
-        {+2.2591740e+001, +4.8563000e+000},  //  (-3,2/sin(pi/3))
-        {+1.6163000e+002, -1.4335600e+002},  //  (-3,3/sin(pi/3))
-        {-8.0047160e+002, -2.1527450e+003},  //  (-3,4/sin(pi/3))
-        {+6.1825900e-001, +0.0000000e+000},  //  (-2,0)
-        {+1.3019600e+000, -1.2290770e+000},  //  (-2,1/sin(pi/3))
-        {+1.5036120e-001, -1.1008090e+001},  //  (-2,2/sin(pi/3))
-        {-7.0116800e+001, -4.0480820e+001},  //  (-2,3/sin(pi/3))
-        {-4.8317170e+002, +4.9692760e+002},  //  (-2,4/sin(pi/3))
-        {+4.8970660e+003, +4.8627290e+003},  //  (-2,5/sin(pi/3))
-        {-1.0160570e-002, +0.0000000e+000},  //  (-1,0)
-        {-5.4826640e-001, -7.1365290e-001},  //  (-1,1/sin(pi/3))
-        {-4.6749130e+000, -1.1924250e-001},  //  (-1,2/sin(pi/3))
-        {-1.0536400e+001, +2.4943710e+001},  //  (-1,3/sin(pi/3))
-        {+1.6333770e+002, +9.0394910e+001},  //  (-1,4/sin(pi/3))
-        {+5.6449460e+002, -1.4248320e+003},  //  (-1,5/sin(pi/3))
-        {-2.5881940e-001, +0.0000000e+000},  //  ( 0,0)
-        {-4.8620750e-001, +1.5689920e-001},  //  ( 0,1/sin(pi/3))
-        {-4.7348130e-001, +1.7093440e+000},  //  ( 0,2/sin(pi/3))
-        {+7.0373840e+000, +3.6281820e+000},  //  ( 0,3/sin(pi/3))
-        {+1.7739590e+001, -4.0360420e+001},  //  ( 0,4/sin(pi/3))
-        {-2.9791510e+002, -3.8408890e+001},  //  ( 0,5/sin(pi/3))
-        {-1.5914740e-001, +0.0000000e+000},  //  ( 1,0)
-        {-1.1340420e-001, +1.9730500e-001},  //  ( 1,1/sin(pi/3))
-        {+4.0126210e-001, +3.9223000e-001},  //  ( 1,2/sin(pi/3))
-        {+1.3348650e+000, -1.4377270e+000},  //  ( 1,3/sin(pi/3))
-        {-7.9022490e+000, -4.2063640e+000},  //  ( 1,4/sin(pi/3))
-        {-1.3892750e+000, +5.1229420e+001},  //  ( 1,5/sin(pi/3))
-        {-5.3090380e-002, +0.0000000e+000},  //  ( 2,0)
-        {-1.6832970e-003, +6.8366970e-002},  //  ( 2,1/sin(pi/3))
-        {+1.3789400e-001, -1.1613800e-002},  //  ( 2,2/sin(pi/3))
-        {-1.4713730e-001, -3.7151990e-001},  //  ( 2,3/sin(pi/3))
-        {-1.0070200e+000, +1.1591350e+000},  //  ( 2,4/sin(pi/3))
-        {+7.5045050e+000, +4.6913120e-001},  //  ( 2,5/sin(pi/3))
-        {-1.1912980e-002, +0.0000000e+000},  //  ( 3,0)
-        {+5.1468570e-003, +1.3660890e-002},  //  ( 3,1/sin(pi/3))
-        {+1.8309710e-002, -1.8808590e-002},  //  ( 3,2/sin(pi/3))
-        {-6.4461590e-002, -1.3611790e-002},  //  ( 3,3/sin(pi/3))
-        {+1.0516240e-001, +1.9313050e-001},  //  ( 3,4/sin(pi/3))
-        {+2.0520050e-001, -9.1772620e-001},  //  ( 3,5/sin(pi/3))
-        {-1.9586410e-003, +0.0000000e+000},  //  ( 4,0)
-        {+1.4695650e-003, +1.8086380e-003},  //  ( 4,1/sin(pi/3))
-        {+5.9709950e-004, -3.8332700e-003},  //  ( 4,2/sin(pi/3))
-        {-6.8910890e-003, +5.4467430e-003},  //  ( 4,3/sin(pi/3))
-        {+2.6167930e-002, -8.4092000e-004},  //  ( 4,4/sin(pi/3))
-        {-8.8284470e-002, -4.6475310e-002},  //  ( 4,5/sin(pi/3))
-        {-2.4741390e-004, +0.0000000e+000},  //  ( 5,0)
-        {+2.3707840e-004, +1.6461110e-004},  //  ( 5,1/sin(pi/3))
-        {-1.7465570e-004, -4.2026780e-004},  //  ( 5,2/sin(pi/3))
-        {-1.0394520e-004, +9.4761840e-004},  //  ( 5,3/sin(pi/3))
-        {+1.3004110e-003, -2.2446660e-003},  //  ( 5,4/sin(pi/3))
-        {-2.4765200e-005, +0.0000000e+000},  //  ( 6,0)
-        {+2.6714870e-005, +9.8691570e-006},  //  ( 6,1/sin(pi/3))
-        {-3.3539770e-005, -2.7113280e-005},  //  ( 6,2/sin(pi/3))
-        {+4.9197840e-005, +6.9349090e-005},  //  ( 6,3/sin(pi/3))
-        {-2.0081510e-006, +0.0000000e+000},  //  ( 7,0)
-        {+2.2671240e-006, +2.7848510e-007},  //  ( 7,1/sin(pi/3))
-        {-3.2692130e-006, -7.3943490e-007},  //  ( 7,2/sin(pi/3))
-    };
-
-    /////////////////////////////////////////////////////////////////////////
-
-    // Complex array of the value Bi(a) Airy function
-    // where a is the complex location of the center of expansion of the Taylor series
-    constexpr std::complex<double> BV[] = {
-        {-1.466984e-001, -9.813078e-017},  // (-6,0)
-        {-1.489391e+000, -2.660635e+000},  // (-6,1/sin(pi/3))
-        {-1.383691e-001, +0.000000e+000},  // (-5,0)
-        {-7.034482e-001, +2.384547e+000},  // (-5,1/sin(pi/3))
-        {+3.460723e+000, +3.363363e+001},  // (-5,2/sin(pi/3))
-        {+3.369090e+002, +3.444973e+002},  // (-5,3/sin(pi/3))
-        {+3.922347e-001, -1.041605e-016},  // (-4,0)
-        {+1.956219e+000, -5.327226e-001},  // (-4,1/sin(pi/3))
-        {+1.602464e+001, -1.338050e+001},  // (-4,2/sin(pi/3))
-        {+3.207239e+001, -2.296777e+002},  // (-4,3/sin(pi/3))
-        {-2.191768e+003, -1.804078e+003},  // (-4,4/sin(pi/3))
-        {-1.982896e-001, +4.440892e-016},  // (-3,0)
-        {-8.880754e-001, -1.308713e+000},  // (-3,1/sin(pi/3))
-        {-1.062975e+001, -6.044056e+000},  // (-3,2/sin(pi/3))
-        {-9.881405e+001, +3.116914e+001},  // (-3,3/sin(pi/3))
-        {-1.390528e+002, +9.892534e+002},  // (-3,4/sin(pi/3))
-        {-4.123026e-001, +1.451806e-016},  // (-2,0)
-        {-1.034766e+000, +6.541962e-001},  // (-2,1/sin(pi/3))
-        {-2.720266e+000, +6.048328e+000},  // (-2,2/sin(pi/3))
-        {+2.096300e+001, +3.630613e+001},  // (-2,3/sin(pi/3))
-        {+3.090465e+002, -6.713963e+001},  // (-2,4/sin(pi/3))
-        {-4.664937e+002, -2.800165e+003},  // (-2,5/sin(pi/3))
-        {+1.039974e-001, +0.000000e+000},  // (-1,0)
-        {+2.797458e-001, +8.086491e-001},  // (-1,1/sin(pi/3))
-        {+2.606133e+000, +1.870297e+000},  // (-1,2/sin(pi/3))
-        {+1.292648e+001, -7.213647e+000},  // (-1,3/sin(pi/3))
-        {-3.208774e+001, -8.178697e+001},  // (-1,4/sin(pi/3))
-        {-5.692218e+002, +2.993394e+002},  // (-1,5/sin(pi/3))
-        {+6.149266e-001, +0.000000e+000},  // ( 0,0)
-        {+6.732023e-001, +3.575876e-001},  // ( 0,1/sin(pi/3))
-        {+1.125057e+000, -4.471292e-001},  // ( 0,2/sin(pi/3))
-        {-1.211148e+000, -4.191469e+000},  // ( 0,3/sin(pi/3))
-        {-1.960240e+001, +7.182663e+000},  // ( 0,4/sin(pi/3))
-        {+7.595175e+001, +1.012911e+002},  // ( 0,5/sin(pi/3))
-        {+1.207424e+000, +0.000000e+000},  // ( 1,0)
-        {+5.951440e-001, +6.156664e-001},  // ( 1,1/sin(pi/3))
-        {-1.002325e-001, -1.338228e-001},  // ( 1,2/sin(pi/3))
-        {-1.089323e+000, -2.019524e-001},  // ( 1,3/sin(pi/3))
-        {+7.047139e-001, +4.091592e+000},  // ( 1,4/sin(pi/3))
-        {+1.691067e+001, -1.302705e+001},  // ( 1,5/sin(pi/3))
-        {+3.298095e+000, +0.000000e+000},  // ( 2,0)
-        {+2.244706e-001, +2.421124e+000},  // ( 2,1/sin(pi/3))
-        {-1.199515e+000, -1.167656e-001},  // ( 2,2/sin(pi/3))
-        {+6.781072e-003, -2.225418e-001},  // ( 2,3/sin(pi/3))
-        {+7.470822e-001, +1.832986e-001},  // ( 2,4/sin(pi/3))
-        {-1.590993e+000, -2.617694e+000},  // ( 2,5/sin(pi/3))
-        {+1.403733e+001, +0.000000e+000},  // ( 3,0)
-        {-3.731398e+000, +1.066394e+001},  // ( 3,1/sin(pi/3))
-        {-4.440986e+000, -4.309647e+000},  // ( 3,2/sin(pi/3))
-        {+2.373933e+000, -5.300179e-001},  // ( 3,3/sin(pi/3))
-        {-2.821481e-001, +5.657373e-001},  // ( 3,4/sin(pi/3))
-        {-3.904913e-001, -5.168316e-002},  // ( 3,5/sin(pi/3))
-        {+8.384707e+001, +0.000000e+000},  // ( 4,0)
-        {-4.356467e+001, +5.497027e+001},  // ( 4,1/sin(pi/3))
-        {-7.156364e+000, -4.113550e+001},  // ( 4,2/sin(pi/3))
-        {+1.455852e+001, +1.109071e+001},  // ( 4,3/sin(pi/3))
-        {-6.111359e+000, -1.094609e-001},  // ( 4,4/sin(pi/3))
-        {+1.403434e+000, -7.255043e-001},  // ( 4,5/sin(pi/3))
-        {+6.577920e+002, +0.000000e+000},  // ( 5,0)
-        {-4.598656e+002, +3.242259e+002},  // ( 5,1/sin(pi/3))
-        {+1.324505e+002, -3.294705e+002},  // ( 5,2/sin(pi/3))
-        {+2.057579e+001, +1.674034e+002},  // ( 5,3/sin(pi/3))
-        {-3.161505e+001, -5.302141e+001},  // ( 5,4/sin(pi/3))
-        {+6.536446e+003, +0.000000e+000},  // ( 6,0)
-        {-5.316522e+003, +1.992175e+003},  // ( 6,1/sin(pi/3))
-        {+2.888529e+003, -2.373473e+003},  // ( 6,2/sin(pi/3))
-        {-1.078657e+003, +1.551931e+003},  // ( 6,3/sin(pi/3))
-        {+8.032779e+004, +0.000000e+000},  // ( 7,0)
-        {-7.001987e+004, +8.828416e+003},  // ( 7,1/sin(pi/3))
-        {+4.676699e+004, -1.085924e+004}   // ( 7,2/sin(pi/3))
-    };
-
-    //////////////////////////////////////////////////////////////
-
-    // Complex array of the value Bi'(a) derivative of the Airy function
-    // where a is the complex location of the center of expansion of the Taylor series
-    // presumably for Ai'[z]
-    constexpr std::complex<double> BPV[] = {
-        {-8.128988e-001, +3.365185e-016},  //    (-6,0)
-        {-6.287609e+000, +4.146176e+000},  //    (-6,1/sin(pi/3))
-        {+7.784118e-001, -3.004629e-016},  //    (-5,0)
-        {+5.554036e+000, +1.063645e+000},  //    (-5,1/sin(pi/3))
-        {+7.490659e+001, -2.336310e+001},  //    (-5,2/sin(pi/3))
-        {+5.670796e+002, -1.026488e+003},  //    (-5,3/sin(pi/3))
-        {-1.166706e-001, +2.371654e-015},  //    (-4,0)
-        {-1.532413e+000, -3.730947e+000},  //    (-4,1/sin(pi/3))
-        {-3.554558e+001, -2.608034e+001},  //    (-4,2/sin(pi/3))
-        {-5.124001e+002, +1.076185e+002},  //    (-4,3/sin(pi/3))
-        {-1.809619e+003, +6.659780e+003},  //    (-4,4/sin(pi/3))
-        {-6.756112e-001, -2.403703e-017},  //    (-3,0)
-        {-2.142202e+000, +1.818610e+000},  //    (-3,1/sin(pi/3))
-        {-4.863137e+000, +2.258023e+001},  //    (-3,2/sin(pi/3))
-        {+1.433564e+002, +1.616285e+002},  //    (-3,3/sin(pi/3))
-        {+2.152746e+003, -8.004716e+002},  //    (-3,4/sin(pi/3))
-        {+2.787952e-001, +0.000000e+000},  //    (-2,0)
-        {+1.300360e+000, +1.185229e+000},  //    (-2,1/sin(pi/3))
-        {+1.103082e+001, +1.397575e-001},  //    (-2,2/sin(pi/3))
-        {+4.048422e+001, -7.011484e+001},  //    (-2,3/sin(pi/3))
-        {-4.969277e+002, -4.831712e+002},  //    (-2,4/sin(pi/3))
-        {-4.862729e+003, +4.897066e+003},  //    (-2,5/sin(pi/3))
-        {+5.923756e-001, +0.000000e+000},  //    (-1,0)
-        {+9.080502e-001, -5.080757e-001},  //    (-1,1/sin(pi/3))
-        {+1.499485e-001, -4.631403e+000},  //    (-1,2/sin(pi/3))
-        {-2.494926e+001, -1.052676e+001},  //    (-1,3/sin(pi/3))
-        {-9.039663e+001, +1.633370e+002},  //    (-1,4/sin(pi/3))
-        {+1.424833e+003, +5.644943e+002},  //    (-1,5/sin(pi/3))
-        {+4.482884e-001, +0.000000e+000},  //    ( 0,0)
-        {+2.493288e-002, -1.876446e-001},  //    ( 0,1/sin(pi/3))
-        {-1.774795e+000, -3.533830e-001},  //    ( 0,2/sin(pi/3))
-        {-3.663891e+000, +7.026174e+000},  //    ( 0,3/sin(pi/3))
-        {+4.036322e+001, +1.773235e+001},  //    ( 0,4/sin(pi/3))
-        {+3.840990e+001, -2.979143e+002},  //    ( 0,5/sin(pi/3))
-        {+9.324359e-001, +0.000000e+000},  //    ( 1,0)
-        {-1.293870e-001, +7.817697e-001},  //    ( 1,1/sin(pi/3))
-        {-8.385825e-001, +4.901385e-001},  //    ( 1,2/sin(pi/3))
-        {+1.421331e+000, +1.181168e+000},  //    ( 1,3/sin(pi/3))
-        {+4.244380e+000, -7.895016e+000},  //    ( 1,4/sin(pi/3))
-        {-5.123410e+001, -1.383387e+000},  //    ( 1,5/sin(pi/3))
-        {+4.100682e+000, +0.000000e+000},  //    ( 2,0)
-        {-9.576171e-001, +3.432468e+000},  //    ( 2,1/sin(pi/3))
-        {-1.747487e+000, -8.602854e-001},  //    ( 2,2/sin(pi/3))
-        {+9.978890e-001, -6.434913e-001},  //    ( 2,3/sin(pi/3))
-        {-1.127841e+000, -7.762214e-001},  //    ( 2,4/sin(pi/3))
-        {-5.136144e-001, +7.476880e+000},  //    ( 2,5/sin(pi/3))
-        {+2.292221e+001, +0.000000e+000},  //    ( 3,0)
-        {-1.021000e+001, +1.662556e+001},  //    ( 3,1/sin(pi/3))
-        {-5.018884e+000, -1.067168e+001},  //    ( 3,2/sin(pi/3))
-        {+5.067979e+000, +1.074279e+000},  //    ( 3,3/sin(pi/3))
-        {-1.620678e+000, +1.029461e+000},  //    ( 3,4/sin(pi/3))
-        {+1.055970e+000, -2.041230e-001},  //    ( 3,5/sin(pi/3))
-        {+1.619267e+002, +0.000000e+000},  //    ( 4,0)
-        {-1.021827e+002, +9.434616e+001},  //    ( 4,1/sin(pi/3))
-        {+9.638391e+000, -8.764529e+001},  //    ( 4,2/sin(pi/3))
-        {+2.157904e+001, +3.568852e+001},  //    ( 4,3/sin(pi/3))
-        {-1.346647e+001, -6.665778e+000},  //    ( 4,4/sin(pi/3))
-        {+4.276735e+000, -9.657825e-002},  //    ( 4,5/sin(pi/3))
-        {+1.435819e+003, +0.000000e+000},  //    ( 5,0)
-        {-1.099383e+003, +5.897525e+002},  //    ( 5,1/sin(pi/3))
-        {+4.709887e+002, -6.717565e+002},  //    ( 5,2/sin(pi/3))
-        {-7.965464e+001, +4.040825e+002},  //    ( 5,3/sin(pi/3))
-        {-2.418965e+001, -1.582957e+002},  //    ( 5,4/sin(pi/3))
-        {+1.572560e+004, +0.000000e+000},  //    ( 6,0)
-        {-1.334470e+004, +3.525428e+003},  //    ( 6,1/sin(pi/3))
-        {+8.229089e+003, -4.446372e+003},  //    ( 6,2/sin(pi/3))
-        {-3.795705e+003, +3.141147e+003},  //    ( 6,3/sin(pi/3))
-        {+2.095527e+005, +0.000000e+000},  //    ( 7,0)
-        {-1.853403e+005, +7.452520e+003},  //    ( 7,1/sin(pi/3))
-        {+1.286235e+005, -8.069218e+003}   //    ( 7,2/sin(pi/3))
-    };
+namespace {
 
-    ////////////////////////////////////////
-    // Validate inputs - kind & scaling   //
-    ////////////////////////////////////////
-    if ((kind != AiryKind::AIRY) && (kind != AiryKind::AIRYD)
-        && (kind != AiryKind::BAIRY) && (kind != AiryKind::BAIRYD)
-        && (kind != AiryKind::WONE) && (kind != AiryKind::DWONE)
-        && (kind != AiryKind::WTWO) && (kind != AiryKind::DWTWO)) {
-        std::ostringstream oss;
-        oss << "Airy(): `kind` must be one of `AIRY` ("
-            << static_cast<int>(AiryKind::AIRY) << "), `AIRYD` ("
-            << static_cast<int>(AiryKind::AIRYD) << "), `BAIRY` ("
-            << static_cast<int>(AiryKind::BAIRY) << "), `BAIRYD` ("
-            << static_cast<int>(AiryKind::BAIRYD) << "), `WONE` ("
-            << static_cast<int>(AiryKind::WONE) << "), `DWONE` ("
-            << static_cast<int>(AiryKind::DWONE) << "), `WTWO` ("
-            << static_cast<int>(AiryKind::WTWO) << "), `DWTWO` ("
-            << static_cast<int>(AiryKind::DWTWO) << "), not "
-            << static_cast<int>(kind);
-        throw std::invalid_argument(oss.str());
-    };
+/*******************************************************************************
+ * Finds the desired Airy function and, for a pair, its derivative, from one
+ * shifted Taylor series or asymptotic evaluation.
+ *
+ * The shifted Taylor series always sums the function and its derivative
+ * together. The asymptotic series for each differ only in their coefficients
+ * and leading function, and are summed with the same operations as when
+ * found alone, so results are identical to those of separate calls.
+ *
+ * @param[in]  Z        Complex input argument
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for `Airy()`
+ * @param[in]  pair     If true, find the function of `kind` and its derivative
+ *                      in `F[0]` and `F[1]`, whether `kind` is a function or a
+ *                      derivative. Otherwise, find only the result `kind` asks
+ *                      for, in `F[1]` for a derivative and `F[0]` otherwise
+ * @param[out] F        The results; unspecified unless `SUCCESS` is returned
+ * @return              Return code, as for `TryAiry()`
+ ******************************************************************************/
+ReturnCode EvaluateAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const bool pair,
+    std::complex<double> F[2]
+) noexcept {
+    std::complex<double> A[2], Ai, ZT, B0, B1, B2, B3, AN, U, ZA, ZB, ZU;  // Temps
 
-    if (((kind == AiryKind::WONE) || (kind == AiryKind::WTWO)
-         || (kind == AiryKind::DWONE) || (kind == AiryKind::DWTWO))
-        && ((scaling != AiryScaling::HUFFORD) && (scaling != AiryScaling::WAIT)
-        )) {
-        // Airy functions of the third kind must have either HUFFORD or WAIT scaling
-        std::ostringstream oss;
-        oss << "Airy(): When solving an Airy function of the third kind, "
-               "`scaling` must be one of `HUFFORD` ("
-            << static_cast<int>(AiryScaling::HUFFORD) << ") or `WAIT` ("
-            << static_cast<int>(AiryScaling::WAIT) << "), not "
-            << static_cast<int>(scaling);
-        throw std::invalid_argument(oss.str());
-    } else if ((scaling != AiryScaling::NONE)
-               && (scaling != AiryScaling::HUFFORD)
-               && (scaling != AiryScaling::WAIT)) {
-        std::ostringstream oss;
-        oss << "Airy(): `scaling` must be one of `NONE` ("
-            << static_cast<int>(AiryScaling::NONE) << "), `HUFFORD` ("
-            << static_cast<int>(AiryScaling::HUFFORD) << "), `WAIT` ("
-            << static_cast<int>(AiryScaling::WAIT) << "), not "
-            << static_cast<int>(scaling);
-        throw std::invalid_argument(oss.str());
-    };
+    // Ai is used for either Ai() or Bi() at the center of expansion of the
+    // Taylor series
+    const ReturnCode rtn = ValidateAiryArguments(kind, scaling);
+    if (rtn != SUCCESS)
+        return rtn;
 
-    // Set a flag and index value to control function flow based on whether or not
-    // we are finding a derivative (e.g., Ai', Bi') or not (e.g., Ai, Bi). The
-    // `derivative_idx` ensures that arrays are accessed correctly in each case, while
-    // `derivative_flag` is generally used as a condition.
-    bool derivative_flag;  // True if finding a derivative (e.g., Ai', Bi')
-    int derivative_idx;    // Index used to get correct values from arrays
+    // Set the range of indices into arrays of the results to find. Index 0 is
+    // the function (e.g., Ai, Bi) and index 1 its derivative (e.g., Ai', Bi').
+    // A pair finds both, otherwise only the one which `kind` asks for.
+    int derivative_idx;  // Index of the result which `kind` asks for
     if (kind == AiryKind::DWTWO || kind == AiryKind::DWONE
         || kind == AiryKind::AIRYD || kind == AiryKind::BAIRYD) {
-        derivative_flag = true;
         derivative_idx = 1;
     } else {
-        derivative_flag = false;
         derivative_idx = 0;
     };
+    const int first_idx = pair ? 0 : derivative_idx;
+    const int last_idx = pair ? 1 : derivative_idx;
 
     // Now do something productive with numbers...
 
@@ -551,32 +1165,7 @@ std::complex<double> Airy(
 
     // The following scales the input parameter Z depending on what the user is trying to do.
     // If the user is trying to find just the Ai(Z), Ai'(Z), Bi(Z) or Bi'(Z) there is no scaling.
-    if (kind == AiryKind::AIRY || kind == AiryKind::BAIRY
-        || kind == AiryKind::AIRYD || kind == AiryKind::BAIRYD) {
-        // For Ai(Z) and  Bi(Z) No translation in the complex plane
-        U = std::complex<double>(1.0, 0.0);
-    }
-    // Note that W1 Wait = Wi(2) Hufford and W2 Wait = Wi(1) Hufford
-    // So the following inequalities keep this all straight
-    else if (((kind == AiryKind::DWONE || kind == AiryKind::WONE)
-              && scaling == AiryScaling::HUFFORD)
-             || ((kind == AiryKind::DWTWO || kind == AiryKind::WTWO)
-                 && scaling == AiryScaling::WAIT)) {
-        // This corresponds to Wi(1)(Z) in Eqn 38 Hufford NTIA Report 87-219
-        // or Wait W2
-        U = std::complex<double>(
-            std::cos(2.0 * PI / 3.0), std::sin(2.0 * PI / 3.0)
-        );
-    } else if (((kind == AiryKind::DWTWO || kind == AiryKind::WTWO)
-                && scaling == AiryScaling::HUFFORD)
-               || ((kind == AiryKind::DWONE || kind == AiryKind::WONE)
-                   && scaling == AiryScaling::WAIT)) {
-        // This corresponds to Wi(2)(Z) in Eqn 38 Hufford NTIA Report 87-219
-        // or Wait W1
-        U = std::complex<double>(
-            std::cos(-2.0 * PI / 3.0), std::sin(-2.0 * PI / 3.0)
-        );
-    };
+    U = AiryRotation(kind, scaling);
 
     // Translate the input parameter
     ZU = Z * U;
@@ -627,12 +1216,8 @@ std::complex<double> Airy(
         N = NQTT[CoERealidx + 6] + CoEImagidx;
 
         // Stop if the index N reaches the limit of array AV[] which is 70
-        if (N >= 70) {
-            std::ostringstream oss;
-            oss << "Airy(): Center of expansion index " << N << " is out "
-                << "of range for internal Airy data array. Unable to proceed.";
-            throw std::range_error(oss.str());
-        };
+        if (N >= 70)
+            return ERROR__AIRY_RANGE;
 
         // The next real center of expansion, known here as the area of the Taylor series
         NQ8 = NQTT[CoERealidx + 7];
@@ -736,83 +1321,89 @@ std::complex<double> Airy(
             one = -1.0;  // All other functions use the Airy whose sum alternates sign
         }
 
-        // Compute the asymptotic series either sum over k for (u_k*zeta^-k) or sum over k for (v_k*zeta^-k)
-        // Which is used depends on M => M = 0 use u_k M = 1 use v_k
-        // By doing this backward you don't have to do multiple powers zeta^-1
-        // Note the coefficients are backward so the for loop will be forward
-        std::complex<double> sum1(0.0, 0.0);  // Initialize the temporary sum
-        for (int i = 0; i < 14; i++) {
-            sum1 = (std::pow(one, i) * ASV[i][derivative_idx] + sum1) / ZT;
-        };
-        // Add the first element that is a function of zeta^0
-        sum1 = ASV[SIZE_OF_ASV - 1][derivative_idx] + sum1;
-
-        // Now determine if a second series is necessary
-        // If it is not set the second sum to zero
-
-        ////////////////////////////////////////////////////////////////////////////////////
-        // Historic Note:
-        // Hufford originally used the following inequality in AIRY()
-        // (See OT/ITS RR 11) IF(XT(2) .GT. 0. .AND. XT(l) .LT. ll.8595) LG=4
-        // to determine if a second series is required for a reasonable level of accuracy.
-        // The C translation for the variables defined here
-        // would be if(ZT.imag() <= 0.0) && (ZT.real() >= -ll.8595)
-        // In the LFMF code the inequality for the same purpose is (translated to C)
-        // if((ZT.imag() <= 0.0) && (ZT.real() >= -8.4056))
-        // Since ZT = (2/3)ZU^(3/2) and for ZT.imag() = 0.0 and ZT.real() = -8.4056
-        // ZU = -2.70859033 + j*4.69141606 which has an angle of 2*PI/3
-        // Similarly for Hufford's original code
-        // ZU = -3.40728475 + j*5.90159031 which has an angle of 2*PI/3
-        // Thus we could replace the following with the inequality
-        // if(ZU.arg() > 2.0*PI/3.0)
-        //////////////////////////////////////////////////////////////////////////////////////
-
-        // From Copson the F(z) solution is only valid for phase(z) <= PI/3.0
-        // While the F(z) + i*G(z) solution is necessary for phase(z) > PI/3.0
-        std::complex<double> sum2(0.0, 0.0);  // Initialize the second sum
-        if (std::abs(std::arg(ZU)) > PI / 3.0) {
+        // Sum the series for each result to find. The function and its
+        // derivative differ only in the coefficients and the leading function.
+        for (int idx = first_idx; idx <= last_idx; idx++) {
+            const bool derivative = idx == 1;
+
+            // Compute the asymptotic series either sum over k for (u_k*zeta^-k) or sum over k for (v_k*zeta^-k)
+            // Which is used depends on M => M = 0 use u_k M = 1 use v_k
+            // By doing this backward you don't have to do multiple powers zeta^-1
+            // Note the coefficients are backward so the for loop will be forward
+            std::complex<double> sum1(0.0, 0.0);  // Initialize the temporary sum
             for (int i = 0; i < 14; i++) {
-                sum2 = (ASV[i][derivative_idx] + sum2) / ZT;
+                sum1 = (std::pow(one, i) * ASV[i][idx] + sum1) / ZT;
             };
             // Add the first element that is a function of zeta^0
-            sum2 = ASV[SIZE_OF_ASV - 1][derivative_idx] + sum2;
-        }
-        // If the above condition is not true, only one series is necessary for accuracy
+            sum1 = ASV[SIZE_OF_ASV - 1][idx] + sum1;
 
-        // Now do the final function that leads the sum depending on what the user wants.
-        // The leading function has to be taken apart so that it can be assembled as necessary for
-        // the possible two parts of the sum
-        std::complex<double> ZB2, ZB1;
-        if (kind == AiryKind::BAIRY || kind == AiryKind::BAIRYD) {
-            if (derivative_flag) {
-                ZB = std::sqrt(ZA);  // NIST DLMF 9.7.7
-            } else {
-                ZB = 1.0 / (std::sqrt(ZA));  // NIST DLMF 9.7.8
-            };
-            ZB1 = ZB * std::exp(ZT)
-                / std::sqrt(PI);  // For Bairy multiply by e^(zeta)/sqrt(PI)
-            ZB2 = ZB * 1.0 / (std::exp(ZT) * std::sqrt(PI));
+            // Now determine if a second series is necessary
+            // If it is not set the second sum to zero
 
-        } else {  // All other kind use Airy
-            if (derivative_flag) {
-                ZB = -1.0 * std::sqrt(ZA);  // NIST DLMF 9.7.5
-            } else {
-                ZB = 1.0 / std::sqrt(ZA);  // NIST DLMF 9.7.6
+            ////////////////////////////////////////////////////////////////////////////////////
+            // Historic Note:
+            // Hufford originally used the following inequality in AIRY()
+            // (See OT/ITS RR 11) IF(XT(2) .GT. 0. .AND. XT(l) .LT. ll.8595) LG=4
+            // to determine if a second series is required for a reasonable level of accuracy.
+            // The C translation for the variables defined here
+            // would be if(ZT.imag() <= 0.0) && (ZT.real() >= -ll.8595)
+            // In the LFMF code the inequality for the same purpose is (translated to C)
+            // if((ZT.imag() <= 0.0) && (ZT.real() >= -8.4056))
+            // Since ZT = (2/3)ZU^(3/2) and for ZT.imag() = 0.0 and ZT.real() = -8.4056
+            // ZU = -2.70859033 + j*4.69141606 which has an angle of 2*PI/3
+            // Similarly for Hufford's original code
+            // ZU = -3.40728475 + j*5.90159031 which has an angle of 2*PI/3
+            // Thus we could replace the following with the inequality
+            // if(ZU.arg() > 2.0*PI/3.0)
+            //////////////////////////////////////////////////////////////////////////////////////
+
+            // From Copson the F(z) solution is only valid for phase(z) <= PI/3.0
+            // While the F(z) + i*G(z) solution is necessary for phase(z) > PI/3.0
+            std::complex<double> sum2(0.0, 0.0);  // Initialize the second sum
+            if (std::abs(std::arg(ZU)) > PI / 3.0) {
+                for (int i = 0; i < 14; i++) {
+                    sum2 = (ASV[i][idx] + sum2) / ZT;
+                };
+                // Add the first element that is a function of zeta^0
+                sum2 = ASV[SIZE_OF_ASV - 1][idx] + sum2;
+            }
+            // If the above condition is not true, only one series is necessary for accuracy
+
+            // Now do the final function that leads the sum depending on what the user wants.
+            // The leading function has to be taken apart so that it can be assembled as necessary for
+            // the possible two parts of the sum
+            std::complex<double> ZB2, ZB1;
+            if (kind == AiryKind::BAIRY || kind == AiryKind::BAIRYD) {
+                if (derivative) {
+                    ZB = std::sqrt(ZA);  // NIST DLMF 9.7.7
+                } else {
+                    ZB = 1.0 / (std::sqrt(ZA));  // NIST DLMF 9.7.8
+                };
+                ZB1 = ZB * std::exp(ZT)
+                    / std::sqrt(PI);  // For Bairy multiply by e^(zeta)/sqrt(PI)
+                ZB2 = ZB * 1.0 / (std::exp(ZT) * std::sqrt(PI));
+
+            } else {  // All other kind use Airy
+                if (derivative) {
+                    ZB = -1.0 * std::sqrt(ZA);  // NIST DLMF 9.7.5
+                } else {
+                    ZB = 1.0 / std::sqrt(ZA);  // NIST DLMF 9.7.6
+                };
+                ZB1 = ZB * 1.0
+                    / (2.0 * std::exp(ZT) * std::sqrt(PI)
+                    );  // For Airy multiply be e^(-zeta)/(2.0*sqrt(PI))
+                ZB2 = ZB * std::exp(ZT) / (2.0 * std::sqrt(PI));
             };
-            ZB1 = ZB * 1.0
-                / (2.0 * std::exp(ZT) * std::sqrt(PI)
-                );  // For Airy multiply be e^(-zeta)/(2.0*sqrt(PI))
-            ZB2 = ZB * std::exp(ZT) / (2.0 * std::sqrt(PI));
-        };
 
 
-        // Multiply by the leading coefficient to get the results for NIST DLMF 9.7.5 - 9.7.8
-        if (derivative_flag) {
-            A[derivative_idx]
-                = ZB1 * sum1 - std::complex<double>(0.0, 1.0) * ZB2 * sum2;
-        } else {
-            A[derivative_idx]
-                = ZB1 * sum1 + std::complex<double>(0.0, 1.0) * ZB2 * sum2;
+            // Multiply by the leading coefficient to get the results for NIST DLMF 9.7.5 - 9.7.8
+            if (derivative) {
+                A[idx]
+                    = ZB1 * sum1 - std::complex<double>(0.0, 1.0) * ZB2 * sum2;
+            } else {
+                A[idx]
+                    = ZB1 * sum1 + std::complex<double>(0.0, 1.0) * ZB2 * sum2;
+            };
         };
 
     };  // if (( Z.real() < 6.5 || Z.real() > 7.5 || Z.imag() > 6.35 || N > NQ8 || ((Z.real() == 0 && Z.imag() == 0))))
@@ -822,64 +1413,532 @@ std::complex<double> Airy(
     // End of the Asymptotic Series Calculation //
     //////////////////////////////////////////////
 
-    // Store the desired quantity
-    Ai = A[derivative_idx];
+    for (int idx = first_idx; idx <= last_idx; idx++) {
+        // Store the desired quantity
+        F[idx] = A[idx];
+
+        // Final Transform to get the desired function
+        // Was the input parameter in quadrant 3 or 4?
+        // If it was we have to take the conjugate of the calculation result
+        if (reflection != false) {
+            F[idx] = std::complex<double>(F[idx].real(), -F[idx].imag());
+        };
+
+        // The final scaling factor is a function of the kind, derivative and scaling flags
+        U = AiryScaleFactor(kind, scaling, idx == 1);
 
-    // Final Transform to get the desired function
-    // Was the input parameter in quadrant 3 or 4?
-    // If it was we have to take the conjugate of the calculation result
-    if (reflection != false) {
-        Ai = std::complex<double>(Ai.real(), -Ai.imag());
+        // Scale the return value
+        F[idx] = F[idx] * U;
     };
 
-    // The final scaling factor is a function of the kind, derivative and scaling flags
-    // Hufford Wi(1) and Wi'(1)
-    if ((kind == AiryKind::WONE || kind == AiryKind::DWONE)
-        && (scaling == AiryScaling::HUFFORD)) {
-        if (derivative_flag) {
-            U = 2.0
-              * std::complex<double>(std::cos(PI / 3.0), std::sin(PI / 3.0));
-        } else {
-            U = 2.0
-              * std::complex<double>(std::cos(-PI / 3.0), std::sin(-PI / 3.0));
-        };
+    return SUCCESS;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Finds the desired Airy function, reporting failures by return code instead
+ * of by exception.
+ *
+ * Results are identical to those of `Airy()`, which describes the functions
+ * and their scaling.
+ *
+ * @param[in]  Z        Complex input argument
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for `Airy()`
+ * @param[out] Ai       The desired Airy function calculated at Z; unspecified
+ *                      unless `SUCCESS` is returned
+ * @return              `SUCCESS`; `ERROR__AIRY_ARGUMENT` if the values
+ *                      provided for `kind` or `scaling` are not valid; or
+ *                      `ERROR__AIRY_RANGE` if the calculation requires
+ *                      expansion data outside the range of what is known by
+ *                      this program
+ *
+ * @see ITS::Propagation::LFMF::Airy
+ ******************************************************************************/
+ReturnCode TryAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &Ai
+) noexcept {
+    std::complex<double> F[2];
+    const ReturnCode rtn = EvaluateAiry(Z, kind, scaling, false, F);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    Ai = F[IsAiryDerivative(kind) ? 1 : 0];
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Finds an Airy function and its derivative together.
+ *
+ * Both are found from one shifted Taylor series or asymptotic evaluation,
+ * which costs little more than finding one of them with `Airy()`. Results are
+ * identical to those of separate calls to `Airy()`.
+ *
+ * Either the function or its derivative may be given as `kind`: `AIRY` and
+ * `AIRYD` both give Ai(Z) and Ai'(Z); `BAIRY` and `BAIRYD` give Bi(Z) and
+ * Bi'(Z); `WONE` and `DWONE` give Wi(1)(Z) and Wi'(1)(Z); and `WTWO` and
+ * `DWTWO` give Wi(2)(Z) and Wi'(2)(Z).
+ *
+ * @param[in]  Z        Complex input argument
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for `Airy()`
+ * @param[out] F        The function calculated at Z
+ * @param[out] DF       The derivative of the function calculated at Z
+ * @throws std::invalid_argument  If `kind` or `scaling` is not valid
+ * @throws std::range_error       If the calculation requires expansion data
+ *                                outside the range of what is known by this
+ *                                program
+ *
+ * @see ITS::Propagation::LFMF::Airy
+ * @see ITS::Propagation::LFMF::TryAiryPair
+ ******************************************************************************/
+void AiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &F,
+    std::complex<double> &DF
+) {
+    const ReturnCode rtn = TryAiryPair(Z, kind, scaling, F, DF);
+    if (rtn != SUCCESS)
+        ThrowAiryError(rtn, kind, scaling);
+}
+
+/*******************************************************************************
+ * Finds an Airy function and its derivative together, reporting failures by
+ * return code instead of by exception.
+ *
+ * Results are identical to those of `AiryPair()`.
+ *
+ * @param[in]  Z        Complex input argument
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for `Airy()`
+ * @param[out] F        The function calculated at Z; unspecified unless
+ *                      `SUCCESS` is returned
+ * @param[out] DF       The derivative of the function calculated at Z;
+ *                      unspecified unless `SUCCESS` is returned
+ * @return              Return code, as for `TryAiry()`
+ *
+ * @see ITS::Propagation::LFMF::AiryPair
+ ******************************************************************************/
+ReturnCode TryAiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &F,
+    std::complex<double> &DF
+) noexcept {
+    std::complex<double> values[2];
+    const ReturnCode rtn = EvaluateAiry(Z, kind, scaling, true, values);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    F = values[0];
+    DF = values[1];
+    return SUCCESS;
+}
+
+namespace {
+
+/*******************************************************************************
+ * Finds the desired Airy function and, for a pair, its derivative, from the
+ * table of `FastAiry()`. Bi(Z), Bi'(Z), and arguments outside of the table
+ * are passed on to `EvaluateAiry()`.
+ *
+ * @param[in]  Z         Complex input argument
+ * @param[in]  kind      The type of Airy function to solve
+ * @param[in]  scaling   Type of scaling to use, as for `Airy()`
+ * @param[in]  accuracy  Accuracy tier of the approximation
+ * @param[in]  pair      As for `EvaluateAiry()`
+ * @param[out] F         As for `EvaluateAiry()`
+ * @return               Return code, as for `FastAiry()`
+ ******************************************************************************/
+ReturnCode EvaluateFastAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const AiryAccuracy accuracy,
+    const bool pair,
+    std::complex<double> F[2]
+) noexcept {
+    const ReturnCode rtn = ValidateAiryArguments(kind, scaling);
+    if (rtn != SUCCESS)
+        return rtn;
+    const int tier = static_cast<int>(accuracy);
+    if (tier < 0 || tier >= AIRY_ACCURACY_TIERS)
+        return ERROR__AIRY_ARGUMENT;
+
+    const int derivative_idx = IsAiryDerivative(kind) ? 1 : 0;
+    const int first_idx = pair ? 0 : derivative_idx;
+    const int last_idx = pair ? 1 : derivative_idx;
+
+    if (kind == AiryKind::BAIRY || kind == AiryKind::BAIRYD)
+        return EvaluateAiry(Z, kind, scaling, pair, F);
+
+    // Rotate the argument, and reflect it into quadrants 1 and 2, as `Airy()`
+    std::complex<double> ZU = Z * AiryRotation(kind, scaling);
+    const bool reflection = ZU.imag() <= 0;
+    if (reflection)
+        ZU = std::complex<double>(ZU.real(), -ZU.imag());
+
+    // Find the cell of the argument in the table
+    const double x = (ZU.real() - AIRY_TABLE_REAL_MIN) / AIRY_TABLE_STEP;
+    const double y = ZU.imag() / AIRY_TABLE_STEP;
+    if (!(x >= 0.0 && x < AIRY_TABLE_REAL_CELLS && y < AIRY_TABLE_IMAG_CELLS))
+        return EvaluateAiry(Z, kind, scaling, pair, F);
+    const int l = static_cast<int>(x);
+    const int m = static_cast<int>(y);
+    const AiryTableCell &cell = AIRY_TABLE_CELLS[m * AIRY_TABLE_REAL_CELLS + l];
+    const int n = cell.degree[tier];
+    if (n < 0)
+        return EvaluateAiry(Z, kind, scaling, pair, F);
+
+    // Sum the polynomial, and its derivative if needed, by Horner's method
+    const std::complex<double> center(
+        AIRY_TABLE_REAL_MIN + (l + 0.5) * AIRY_TABLE_STEP,
+        (m + 0.5) * AIRY_TABLE_STEP
+    );
+    const std::complex<double> w = ZU - center;
+    const std::complex<double> *a = &AIRY_TABLE_COEFFICIENTS[cell.offset];
+    std::complex<double> A[2];
+    A[0] = a[n];
+    if (last_idx == 1) {
+        for (int k = n - 1; k >= 0; k--) {
+            A[1] = A[1] * w + A[0];
+            A[0] = A[0] * w + a[k];
+        }
+    } else {
+        for (int k = n - 1; k >= 0; k--)
+            A[0] = A[0] * w + a[k];
     }
-    // Hufford Wi(2) and Wi'(2)
-    else if ((kind == AiryKind::WTWO || kind == AiryKind::DWTWO)
-             && (scaling == AiryScaling::HUFFORD)) {
-        if (derivative_flag) {
-            U = 2.0
-              * std::complex<double>(std::cos(-PI / 3.0), std::sin(-PI / 3.0));
-        } else {
-            U = 2.0
-              * std::complex<double>(std::cos(PI / 3.0), std::sin(PI / 3.0));
-        };
+
+    for (int idx = first_idx; idx <= last_idx; idx++) {
+        F[idx] = A[idx];
+        if (reflection)
+            F[idx] = std::complex<double>(F[idx].real(), -F[idx].imag());
+        F[idx] = F[idx] * AiryScaleFactor(kind, scaling, idx == 1);
     }
-    // Wait W1 and W1'
-    else if ((kind == AiryKind::WONE || kind == AiryKind::DWONE)
-             && (scaling == AiryScaling::WAIT)) {
-        if (derivative_flag) {
-            U = std::complex<double>(
-                -1.0 * std::sqrt(3.0 * PI), -1.0 * std::sqrt(PI)
-            );
-        } else {
-            U = std::complex<double>(std::sqrt(3.0 * PI), -1.0 * std::sqrt(PI));
-        };
+    return SUCCESS;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Finds the desired Airy function from a table of piecewise polynomial
+ * approximations, reporting failures by return code.
+ *
+ * The functions, their scaling, and the return codes are those of `TryAiry()`.
+ * Ai(Z), Ai'(Z), and the functions of the third kind are found from a table of
+ * Ai(Z) when the argument, once rotated as for `Airy()`, has a real part in
+ * [-32, 8) and an imaginary part in (-4, 4). The table covers this region in
+ * square cells with sides of 0.25, which includes every argument used by the
+ * residue series. Other arguments, and Bi(Z) and Bi'(Z), are found as by
+ * `TryAiry()`.
+ *
+ * The table holds the Taylor polynomial of Ai(Z) about the center of each
+ * cell, of a degree chosen per cell so that the truncation error is below the
+ * `accuracy` tier relative to the size of the function on the cell. Results
+ * agree with `Airy()` to within the larger of this tolerance and the accuracy
+ * of `Airy()` itself, about 1e-6 near the zeros of the functions.
+ *
+ * The table is generated ahead of time from `Airy()`, and is compiled into the
+ * library as constant data: there is no cost on first use, and no memory is
+ * allocated.
+ *
+ * @param[in]  Z         Complex input argument
+ * @param[in]  kind      The type of Airy function to solve
+ * @param[in]  scaling   Type of scaling to use, as for `Airy()`
+ * @param[in]  accuracy  Accuracy tier of the approximation
+ * @param[out] Ai        The desired Airy function calculated at Z; unspecified
+ *                       unless `SUCCESS` is returned
+ * @return               Return code, as for `TryAiry()`; also
+ *                       `ERROR__AIRY_ARGUMENT` if `accuracy` is not valid
+ *
+ * @see ITS::Propagation::LFMF::Airy
+ * @see ITS::Propagation::LFMF::AiryAccuracy
+ ******************************************************************************/
+ReturnCode FastAiry(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const AiryAccuracy accuracy,
+    std::complex<double> &Ai
+) noexcept {
+    std::complex<double> F[2];
+    const ReturnCode rtn
+        = EvaluateFastAiry(Z, kind, scaling, accuracy, false, F);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    Ai = F[IsAiryDerivative(kind) ? 1 : 0];
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Finds an Airy function and its derivative together, from the table of
+ * `FastAiry()`.
+ *
+ * The pairs of functions are those of `AiryPair()`. Both are found from one
+ * sum over the table.
+ *
+ * @param[in]  Z         Complex input argument
+ * @param[in]  kind      The type of Airy function to solve
+ * @param[in]  scaling   Type of scaling to use, as for `Airy()`
+ * @param[in]  accuracy  Accuracy tier of the approximation
+ * @param[out] F         The function calculated at Z; unspecified unless
+ *                       `SUCCESS` is returned
+ * @param[out] DF        The derivative of the function calculated at Z;
+ *                       unspecified unless `SUCCESS` is returned
+ * @return               Return code, as for `FastAiry()`
+ *
+ * @see ITS::Propagation::LFMF::FastAiry
+ * @see ITS::Propagation::LFMF::AiryPair
+ ******************************************************************************/
+ReturnCode FastAiryPair(
+    const std::complex<double> Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const AiryAccuracy accuracy,
+    std::complex<double> &F,
+    std::complex<double> &DF
+) noexcept {
+    std::complex<double> values[2];
+    const ReturnCode rtn
+        = EvaluateFastAiry(Z, kind, scaling, accuracy, true, values);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    F = values[0];
+    DF = values[1];
+    return SUCCESS;
+}
+
+namespace {
+
+/*******************************************************************************
+ * Finds Wait's w1 from the table of `ResidueSeriesAiry()`.
+ *
+ * The cells of the table are those of the table of `FastAiry()`, at the
+ * `STANDARD` tier. They cover both sides of the real axis of the rotated
+ * argument, so that no reflection is needed, and the scale factor of Wait's w1
+ * is folded into the coefficients, which are stored highest degree first.
+ *
+ * @param[in]  T   Complex input argument
+ * @param[out] W1  Wait's w1 at T; unchanged if false is returned
+ * @return         False if T is outside of the table
+ ******************************************************************************/
+bool ResidueAiryFromTable(
+    const std::complex<double> T, std::complex<double> &W1
+) noexcept {
+    const std::complex<double> ZU = T * RESIDUE_AIRY_ROTATION;
+    const double x = (ZU.real() - RESIDUE_AIRY_REAL_MIN) / AIRY_TABLE_STEP;
+    const double y = (ZU.imag() - RESIDUE_AIRY_IMAG_MIN) / AIRY_TABLE_STEP;
+    if (!(x >= 0.0 && x < RESIDUE_AIRY_REAL_CELLS && y >= 0.0
+          && y < RESIDUE_AIRY_IMAG_CELLS))
+        return false;
+    const int l = static_cast<int>(x);
+    const int m = static_cast<int>(y);
+    const ResidueAiryCell &cell
+        = RESIDUE_AIRY_CELLS[m * RESIDUE_AIRY_REAL_CELLS + l];
+    if (cell.degree < 0)
+        return false;
+
+    // Sum the polynomial by Horner's method
+    const std::complex<double> center(
+        RESIDUE_AIRY_REAL_MIN + (l + 0.5) * AIRY_TABLE_STEP,
+        RESIDUE_AIRY_IMAG_MIN + (m + 0.5) * AIRY_TABLE_STEP
+    );
+    const std::complex<double> w = ZU - center;
+    const std::complex<double> *b = &RESIDUE_AIRY_COEFFICIENTS[cell.offset];
+    std::complex<double> sum = b[0];
+    for (int k = 1; k <= cell.degree; k++)
+        sum = sum * w + b[k];
+    W1 = sum;
+    return true;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Finds Wait's w1, the Airy function of `WONE` kind with `WAIT` scaling, at
+ * an argument of the residue series.
+ *
+ * The residue series evaluates this function at its roots T[i], which lie
+ * near the ray @f$ \arg t = -\pi / 3 @f$, and at T[i] - y for the height-gain
+ * arguments y of the antennas. Over this region, the function is found from a
+ * table laid out for it: the rotation of the argument is a single product,
+ * there is no reflection or dispatch on the kind and scaling, and the scale
+ * factor is folded into the coefficients. The table covers rotated arguments
+ * with a real part in [-32, 2) and an imaginary part in [-2, 2), at the
+ * `STANDARD` accuracy of `FastAiry()`. Like that of `FastAiry()`, it is
+ * generated ahead of time and compiled into the library as constant data, so
+ * no memory is allocated. Other arguments are found by `TryAiry()`.
+ *
+ * @param[in]  T   Complex input argument
+ * @param[out] W1  Wait's w1 at T; unspecified unless `SUCCESS` is returned
+ * @return         Return code, as for `TryAiry()`
+ *
+ * @see ITS::Propagation::LFMF::FastAiry
+ * @see ITS::Propagation::LFMF::ResidueSeries
+ ******************************************************************************/
+ReturnCode ResidueSeriesAiry(
+    const std::complex<double> T, std::complex<double> &W1
+) noexcept {
+    if (ResidueAiryFromTable(T, W1))
+        return SUCCESS;
+    return TryAiry(T, AiryKind::WONE, AiryScaling::WAIT, W1);
+}
+
+/*******************************************************************************
+ * Finds Wait's w1 at each of an array of arguments of the residue series.
+ *
+ * Arguments outside of the table of the scalar `ResidueSeriesAiry()` are
+ * found together by the batch `TryAiry()`.
+ *
+ * @param[in]  n   Number of arguments
+ * @param[in]  T   Complex input arguments
+ * @param[out] W1  Wait's w1 at each argument; unspecified unless `SUCCESS` is
+ *                 returned
+ * @return         Return code, as for the batch `TryAiry()`
+ ******************************************************************************/
+ReturnCode ResidueSeriesAiry(
+    const std::size_t n, const std::complex<double> *T, std::complex<double> *W1
+) noexcept {
+    std::size_t rest_idx[AIRY_CHUNK];  // Arguments outside of the table
+    std::complex<double> rest[AIRY_CHUNK];
+    std::complex<double> values[AIRY_CHUNK];
+    for (std::size_t b = 0; b < n; b += AIRY_CHUNK) {
+        const std::size_t m = std::min(AIRY_CHUNK, n - b);
+        std::size_t n_rest = 0;
+        for (std::size_t i = b; i < b + m; i++) {
+            if (!ResidueAiryFromTable(T[i], W1[i])) {
+                rest_idx[n_rest] = i;
+                rest[n_rest++] = T[i];
+            }
+        }
+        if (n_rest == 0)
+            continue;
+
+        const ReturnCode rtn = TryAiry(
+            n_rest, rest, AiryKind::WONE, AiryScaling::WAIT, values
+        );
+        if (rtn != SUCCESS)
+            return rtn;
+        for (std::size_t j = 0; j < n_rest; j++)
+            W1[rest_idx[j]] = values[j];
     }
-    // Wait W2 and W2'
-    else if ((kind == AiryKind::WTWO || kind == AiryKind::DWTWO)
-             && (scaling == AiryScaling::WAIT)) {
-        if (derivative_flag) {
-            U = std::complex<double>(-1.0 * std::sqrt(3.0 * PI), std::sqrt(PI));
-        } else {
-            U = std::complex<double>(std::sqrt(3.0 * PI), std::sqrt(PI));
-        };
-    };
+    return SUCCESS;
+}
 
-    // Scale the return value
-    Ai = Ai * U;
+/*******************************************************************************
+ * Finds one kind of Airy function at each of an array of arguments.
+ *
+ * Arguments are grouped by the method of the scalar `Airy()` which evaluates
+ * them. Arguments summed by the shifted Taylor series are further grouped by
+ * center of expansion (the index into the center of expansion arrays found
+ * through `NQTT`), so that each group shares its Taylor coefficients.
+ * Each group is then evaluated in blocks of arguments, one argument per lane.
+ * The loops adding a term of a series to every lane of a block are
+ * branch-free lane loops, which an optimizing compiler may vectorize;
+ * convergence tests and the leading factors of the asymptotic series are
+ * evaluated one lane at a time. Arguments are sorted in chunks of
+ * `AIRY_CHUNK` in arrays on the stack, so no memory is allocated.
+ *
+ * Results of the shifted Taylor series are identical to those of the scalar
+ * `Airy()`. Results of the asymptotic series are identical for arguments of
+ * ordinary magnitude, and otherwise agree to a relative 1e-13. Either may
+ * also differ in the last bits when the compiler is allowed to contract
+ * multiplies and adds.
+ *
+ * @param[in]  n        Number of arguments
+ * @param[in]  Z        Complex input arguments
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for the scalar `Airy()`
+ * @param[out] Ai       The desired Airy function calculated at each argument
+ *
+ * @throws std::invalid_argument If the values provided for `kind` or `scaling`
+ *                               are not valid for `Airy()`.
+ * @throws std::range_error      If the calculation requires expansion data
+ *                               outside the range of what is known by this program.
+ *
+ * @see ITS::Propagation::LFMF::Airy
+ ******************************************************************************/
+void Airy(
+    const std::size_t n,
+    const std::complex<double> *Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *Ai
+) {
+    const ReturnCode rtn = TryAiry(n, Z, kind, scaling, Ai);
+    if (rtn != SUCCESS)
+        ThrowAiryError(rtn, kind, scaling);
+}
 
-    return Ai;
+/*******************************************************************************
+ * Finds one kind of Airy function at each of an array of arguments, reporting
+ * failures by return code instead of by exception.
+ *
+ * Results are identical to those of the batch `Airy()`. If any argument fails,
+ * no results are written.
+ *
+ * @param[in]  n        Number of arguments
+ * @param[in]  Z        Complex input arguments
+ * @param[in]  kind     The type of Airy function to solve
+ * @param[in]  scaling  Type of scaling to use, as for the scalar `Airy()`
+ * @param[out] Ai       The desired Airy function calculated at each argument
+ * @return              Return code, as for the scalar `TryAiry()`
+ *
+ * @see ITS::Propagation::LFMF::Airy
+ ******************************************************************************/
+ReturnCode TryAiry(
+    const std::size_t n,
+    const std::complex<double> *Z,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *Ai
+) noexcept {
+    const ReturnCode rtn = ValidateAiryArguments(kind, scaling);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    const bool derivative_flag
+        = (kind == AiryKind::DWTWO || kind == AiryKind::DWONE
+           || kind == AiryKind::AIRYD || kind == AiryKind::BAIRYD);
+    const int derivative_idx = derivative_flag ? 1 : 0;
+    const bool bairy = (kind == AiryKind::BAIRY || kind == AiryKind::BAIRYD);
+
+    const std::complex<double> U = AiryRotation(kind, scaling);
+    const std::complex<double> scale
+        = AiryScaleFactor(kind, scaling, derivative_flag);
+
+    // Check every argument before writing any result
+    for (std::size_t i = 0; i < n; i++) {
+        std::complex<double> ZU = Z[i] * U;
+        if (ZU.imag() <= 0)
+            ZU = std::complex<double>(ZU.real(), -ZU.imag());
+        int N, NQ8;
+        std::complex<double> CoE;
+        if (AiryCenter(ZU, N, NQ8, CoE) != SUCCESS)
+            return ERROR__AIRY_RANGE;
+    }
+
+    for (std::size_t i = 0; i < n; i += AIRY_CHUNK) {
+        AiryChunk(
+            std::min(AIRY_CHUNK, n - i),
+            &Z[i],
+            U,
+            scale,
+            bairy,
+            derivative_idx,
+            &Ai[i]
+        );
+    }
+    return SUCCESS;
 }
 
 }  // namespace LFMF
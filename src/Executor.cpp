@@ -0,0 +1,313 @@
+/** @file Executor.cpp
+ * Implements a work-stealing thread pool.
+ */
+
+#include "LFMF.h"
+
+#include <algorithm>           // for std::max
+#include <atomic>              // for std::atomic
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <deque>               // for std::deque
+#include <exception>           // for std::exception_ptr
+#include <map>                 // for std::map
+#include <memory>              // for std::unique_ptr
+#include <mutex>               // for std::mutex, std::lock_guard
+#include <thread>              // for std::thread
+#include <utility>             // for std::pair
+#include <vector>              // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+namespace {
+
+/** Executor whose work the current thread is doing, if any */
+thread_local const void *current_executor = nullptr;
+
+/** Number of chunks given to each thread when no chunk size is requested */
+constexpr std::size_t CHUNKS_PER_THREAD = 16;
+
+/** Makes the current thread work for an executor, until destroyed */
+struct CurrentExecutorScope {
+        const void *previous;  // Executor the thread worked for before
+
+        explicit CurrentExecutorScope(const void *executor):
+            previous(current_executor) {
+            current_executor = executor;
+        }
+        ~CurrentExecutorScope() {
+            current_executor = previous;
+        }
+        CurrentExecutorScope(const CurrentExecutorScope &) = delete;
+        CurrentExecutorScope &operator=(const CurrentExecutorScope &) = delete;
+};
+
+}  // namespace
+
+/** Threads and work queues of an `Executor` */
+struct Executor::Impl {
+        typedef std::pair<std::size_t, std::size_t> Chunk;  // [begin, end)
+
+        /** Chunks not yet started by one worker */
+        struct Queue {
+                std::mutex mutex;
+                std::deque<Chunk> chunks;
+        };
+
+        std::vector<std::thread> threads;  // Helper threads, workers 1..n
+        std::vector<std::unique_ptr<Queue>> queues;  // One for each worker
+
+        std::mutex run_mutex;  // Serializes calls to ParallelFor()
+
+        std::mutex mutex;  // Guards the members below
+        std::condition_variable start_cv;
+        std::condition_variable done_cv;
+        const std::function<void(std::size_t, std::size_t)> *body = nullptr;
+        unsigned long generation = 0;  // Incremented for each job
+        unsigned int busy = 0;         // Helper threads still in the job
+        bool stopping = false;
+        std::exception_ptr error;  // First exception thrown by the body
+
+        std::atomic<bool> cancelled{false};
+
+        /** Take the next chunk of worker `id`, or steal one */
+        bool NextChunk(const std::size_t id, Chunk &chunk) {
+            {
+                Queue &own = *queues[id];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.chunks.empty()) {
+                    chunk = own.chunks.front();
+                    own.chunks.pop_front();
+                    return true;
+                }
+            }
+            // Steal from the end of the other queues, furthest from where
+            // their owners are working
+            for (std::size_t k = 1; k < queues.size(); k++) {
+                Queue &victim = *queues[(id + k) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.chunks.empty()) {
+                    chunk = victim.chunks.back();
+                    victim.chunks.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** Run chunks until none are left */
+        void Work(const std::size_t id) {
+            Chunk chunk;
+            while (!cancelled && NextChunk(id, chunk)) {
+#ifdef LFMF_NO_EXCEPTIONS
+                (*body)(chunk.first, chunk.second);
+#else
+                try {
+                    (*body)(chunk.first, chunk.second);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error)
+                        error = std::current_exception();
+                    cancelled = true;
+                }
+#endif
+            }
+        }
+
+        /** Main loop of helper thread `id` */
+        void ThreadMain(const std::size_t id) {
+            current_executor = this;
+            unsigned long seen = 0;
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                start_cv.wait(lock, [&]() {
+                    return stopping || generation != seen;
+                });
+                if (stopping)
+                    return;
+                seen = generation;
+
+                lock.unlock();
+                Work(id);
+                lock.lock();
+
+                if (--busy == 0)
+                    done_cv.notify_all();
+            }
+        }
+};
+
+/*******************************************************************************
+ * Start a thread pool.
+ *
+ * If a thread cannot be started, the threads already started are stopped and
+ * the `std::system_error` is rethrown.
+ *
+ * @param[in] n_threads  Number of threads, including the thread which calls
+ *                       `ParallelFor()`; 0 uses one thread for each hardware
+ *                       thread
+ ******************************************************************************/
+Executor::Executor(const unsigned int n_threads) : impl(new Impl) {
+    unsigned int n_workers = n_threads;
+    if (n_workers == 0)
+        n_workers = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int id = 0; id < n_workers; id++)
+        impl->queues.emplace_back(new Impl::Queue);
+#ifdef LFMF_NO_EXCEPTIONS
+    for (unsigned int id = 1; id < n_workers; id++)
+        impl->threads.emplace_back(&Impl::ThreadMain, impl.get(), id);
+#else
+    try {
+        for (unsigned int id = 1; id < n_workers; id++)
+            impl->threads.emplace_back(&Impl::ThreadMain, impl.get(), id);
+    } catch (...) {
+        Stop();
+        throw;
+    }
+#endif
+}
+
+/*******************************************************************************
+ * Stop the thread pool, after any running `ParallelFor()` call returns.
+ ******************************************************************************/
+Executor::~Executor() {
+    std::lock_guard<std::mutex> run_lock(impl->run_mutex);
+    Stop();
+}
+
+/*******************************************************************************
+ * Stop and join the helper threads.
+ ******************************************************************************/
+void Executor::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopping = true;
+    }
+    impl->start_cv.notify_all();
+    for (std::thread &thread : impl->threads)
+        thread.join();
+}
+
+/*******************************************************************************
+ * Get the number of threads of the pool, including the calling thread.
+ *
+ * @return  Number of threads
+ ******************************************************************************/
+unsigned int Executor::GetThreadCount() const {
+    return static_cast<unsigned int>(impl->queues.size());
+}
+
+/*******************************************************************************
+ * Call `body(begin, end)` for chunks of the indices [0, n), using every
+ * thread of the pool, and return once all chunks are done.
+ *
+ * Chunks do not overlap and together cover [0, n). The body is called from
+ * several threads at once, so it must only write output for its own indices.
+ * If the body throws, no further chunks are started, and the first exception
+ * is rethrown once running chunks finish. A library built without exceptions
+ * does not catch exceptions thrown by the body.
+ *
+ * @param[in] n           Number of indices
+ * @param[in] chunk_size  Number of indices in each chunk; 0 chooses a size
+ *                        giving several chunks to each thread
+ * @param[in] body        Function evaluating the indices [begin, end)
+ ******************************************************************************/
+void Executor::ParallelFor(
+    const std::size_t n,
+    const std::size_t chunk_size,
+    const std::function<void(std::size_t, std::size_t)> &body
+) {
+    if (n == 0)
+        return;
+
+    const std::size_t n_workers = impl->queues.size();
+    std::size_t chunk = chunk_size;
+    if (chunk == 0)
+        chunk = std::max<std::size_t>(1, n / (n_workers * CHUNKS_PER_THREAD));
+
+    // Without helper threads, or from inside a body, run on this thread
+    if (impl->threads.empty() || current_executor == impl.get()) {
+        for (std::size_t begin = 0; begin < n; begin += chunk)
+            body(begin, std::min(n, begin + chunk));
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(impl->run_mutex);
+
+    // Give each worker an equal, contiguous share of the chunks
+    const std::size_t n_chunks = (n + chunk - 1) / chunk;
+    for (std::size_t id = 0; id < n_workers; id++) {
+        Impl::Queue &queue = *impl->queues[id];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        const std::size_t first = id * n_chunks / n_workers;
+        const std::size_t last = (id + 1) * n_chunks / n_workers;
+        for (std::size_t c = first; c < last; c++)
+            queue.chunks.emplace_back(c * chunk, std::min(n, (c + 1) * chunk));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->body = &body;
+        impl->error = nullptr;
+        impl->cancelled = false;
+        impl->busy = static_cast<unsigned int>(impl->threads.size());
+        impl->generation++;
+    }
+    impl->start_cv.notify_all();
+
+    {
+        const CurrentExecutorScope scope(impl.get());
+        impl->Work(0);
+    }
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(impl->mutex);
+        impl->done_cv.wait(lock, [&]() { return impl->busy == 0; });
+        impl->body = nullptr;
+        error = impl->error;
+        impl->error = nullptr;
+    }
+
+    if (error) {
+        // Discard the chunks which were not started
+        for (auto &queue : impl->queues) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->chunks.clear();
+        }
+        std::rethrow_exception(error);
+    }
+}
+
+/*******************************************************************************
+ * Get the thread pool shared by the library functions which run in parallel.
+ *
+ * One pool is started for each distinct thread count, on first use, and kept
+ * until the process exits, so repeated calls do not start and join threads.
+ * The pools are never destroyed: joining threads while a shared library is
+ * unloaded, or while static objects are destroyed at exit, can deadlock.
+ *
+ * @param[in] n_threads  Number of threads, including the thread which calls
+ *                       `ParallelFor()`; 0 uses one thread for each hardware
+ *                       thread
+ * @return               Thread pool with `n_threads` threads
+ * @throw std::system_error  If the threads of a new pool cannot be started
+ ******************************************************************************/
+Executor &SharedExecutor(const unsigned int n_threads) {
+    static std::mutex &mutex = *new std::mutex;
+    static std::map<unsigned int, Executor *> &pools =
+        *new std::map<unsigned int, Executor *>;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Executor *&pool = pools[n_threads];
+    if (pool == nullptr)
+        pool = new Executor(n_threads);
+    return *pool;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
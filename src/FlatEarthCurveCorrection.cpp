@@ -6,11 +6,71 @@
 
 #include <cmath>    // for abs, exp, pow, sqrt
 #include <complex>  // for std::complex
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
 
 namespace ITS {
 namespace Propagation {
 namespace LFMF {
 
+namespace {
+
+/*******************************************************************************
+ * Argument of the Faddeeva function used by the flat Earth approximation.
+ *
+ * @param[in] delta  Surface impedance
+ * @param[in] d__km  Path distance, in km
+ * @param[in] k      Wavenumber, in rad/km
+ * @return           Argument qi, with p = qi^2 the numerical distance
+ ******************************************************************************/
+std::complex<double> FlatEarthArgument(
+    const std::complex<double> delta, const double d__km, const double k
+) {
+    const std::complex<double> j = std::complex<double>(0.0, 1.0);
+
+    // In order for the wofz() function to be used both here and in gwfe()
+    // the argument, qi, has to be defined correctly. The following is how
+    // it is done in the original GWFEC.FOR
+    return (-0.5 + j * 0.5) * std::sqrt(k * d__km) * delta;
+}
+
+/*******************************************************************************
+ * Normalized electric field f(x) for |q| > 0.1, given the Faddeeva function
+ * at qi.
+ *
+ * @param[in] q       Intermediate value -j*nu*delta
+ * @param[in] qi      Argument from `FlatEarthArgument()`
+ * @param[in] wofz_qi Faddeeva function W(qi)
+ * @return            Normalized electric field f(x)
+ ******************************************************************************/
+std::complex<double> FlatEarthFofx(
+    const std::complex<double> q,
+    const std::complex<double> qi,
+    const std::complex<double> wofz_qi
+) {
+    const std::complex<double> j = std::complex<double>(0.0, 1.0);
+
+    const std::complex<double> p = qi * qi;
+    const std::complex<double> p2 = std::pow(p, 2);
+    const std::complex<double> q3 = std::pow(q, 3);
+    const std::complex<double> q6 = std::pow(q, 6);
+
+    // Find F(p) Eqn (32) NTIA Report 99-368
+    std::complex<double> Fofp = 1.0 + std::sqrt(PI) * j * qi * wofz_qi;
+
+    // Calculate f(x) which is the normalized electric field, E_ratio; Eqn (31) NTIA Report 99-368
+    std::complex<double> fofx = Fofp
+         + (1.0 - j * std::sqrt(PI * p) - (1.0 + 2.0 * p) * Fofp)
+               / (4.0 * q3);
+    fofx = fofx
+         + (1.0 - j * std::sqrt(PI * p) * (1.0 - p) - 2.0 * p
+            + 5.0 * p2 / 6.0 + (p2 / 2.0 - 1.0) * Fofp)
+               / (4.0 * q6);
+    return fofx;
+}
+
+}  // namespace
+
 /*******************************************************************************
  * Calculates the groundwave field strength using the flat Earth approximation
  * with curvature correction.
@@ -41,16 +101,36 @@ double FlatEarthCurveCorrection(
     const double k,
     const double a_e__km
 ) {
-    const std::complex<double> j = std::complex<double>(0.0, 1.0);
+    const std::complex<double> fofx
+        = FlatEarthAttenuation(delta, q, d__km, k, a_e__km);
 
-    // In order for the wofz() function to be used both here and in gwfe()
-    // the argument, qi, has to be defined correctly. The following is how
-    // it is done in the original GWFEC.FOR
-    const std::complex<double> qi
-        = (-0.5 + j * 0.5) * std::sqrt(k * d__km) * delta;
-    const std::complex<double> p = qi * qi;
+    return FlatEarthHeightGain(fofx, delta, h_1__km, h_2__km, k);
+}
 
-    const std::complex<double> p2 = std::pow(p, 2);
+/*******************************************************************************
+ * Calculates the normalized electric field f(x) of the flat Earth
+ * approximation with curvature correction, for antennas at ground level.
+ *
+ * This factor does not depend on antenna heights. See
+ * `FlatEarthCurveCorrection()` for references.
+ *
+ * @param[in] delta    Surface impedance
+ * @param[in] q        Intermediate value -j*nu*delta
+ * @param[in] d__km    Path distance, in km
+ * @param[in] k        Wavenumber, in rad/km
+ * @param[in] a_e__km  Effective earth radius, in km
+ * @return             Normalized electric field f(x)
+ ******************************************************************************/
+std::complex<double> FlatEarthAttenuation(
+    const std::complex<double> delta,
+    const std::complex<double> q,
+    const double d__km,
+    const double k,
+    const double a_e__km
+) {
+    const std::complex<double> j = std::complex<double>(0.0, 1.0);
+
+    const std::complex<double> qi = FlatEarthArgument(delta, d__km, k);
     const std::complex<double> q3 = std::pow(q, 3);
     const std::complex<double> q6 = std::pow(q, 6);
     const std::complex<double> q9 = std::pow(q, 9);
@@ -58,17 +138,7 @@ double FlatEarthCurveCorrection(
     std::complex<double> fofx;
 
     if (std::abs(q) > 0.1) {
-        // Find F(p) Eqn (32) NTIA Report 99-368
-        std::complex<double> Fofp = 1.0 + std::sqrt(PI) * j * qi * wofz(qi);
-
-        // Calculate f(x) which is the normalized electric field, E_ratio; Eqn (31) NTIA Report 99-368
-        fofx = Fofp
-             + (1.0 - j * std::sqrt(PI * p) - (1.0 + 2.0 * p) * Fofp)
-                   / (4.0 * q3);
-        fofx = fofx
-             + (1.0 - j * std::sqrt(PI * p) * (1.0 - p) - 2.0 * p
-                + 5.0 * p2 / 6.0 + (p2 / 2.0 - 1.0) * Fofp)
-                   / (4.0 * q6);
+        fofx = FlatEarthFofx(q, qi, wofz(qi));
     } else {
         std::complex<double> A[10];
 
@@ -102,6 +172,71 @@ double FlatEarthCurveCorrection(
         }
     }
 
+    return fofx;
+}
+
+/*******************************************************************************
+ * Calculates the normalized electric field f(x) of the flat Earth
+ * approximation with curvature correction at many path distances.
+ *
+ * When |q| > 0.1, the Faddeeva function is evaluated for every distance at
+ * once by the batch `wofz()`. Results match those of the single-distance
+ * `FlatEarthAttenuation()` within the tolerance of the batch `wofz()`.
+ *
+ * @param[in]  delta    Surface impedance
+ * @param[in]  q        Intermediate value -j*nu*delta
+ * @param[in]  n        Number of distances
+ * @param[in]  d__km    Path distances, in km
+ * @param[in]  k        Wavenumber, in rad/km
+ * @param[in]  a_e__km  Effective earth radius, in km
+ * @param[out] fofx     Normalized electric field f(x) at each distance
+ ******************************************************************************/
+void FlatEarthAttenuation(
+    const std::complex<double> delta,
+    const std::complex<double> q,
+    const std::size_t n,
+    const double *d__km,
+    const double k,
+    const double a_e__km,
+    std::complex<double> *fofx
+) {
+    if (std::abs(q) <= 0.1) {
+        for (std::size_t i = 0; i < n; i++)
+            fofx[i] = FlatEarthAttenuation(delta, q, d__km[i], k, a_e__km);
+        return;
+    }
+
+    std::vector<std::complex<double>> qi(n);
+    for (std::size_t i = 0; i < n; i++)
+        qi[i] = FlatEarthArgument(delta, d__km[i], k);
+
+    std::vector<std::complex<double>> w(n);
+    wofz(n, qi.data(), w.data());
+
+    for (std::size_t i = 0; i < n; i++)
+        fofx[i] = FlatEarthFofx(q, qi[i], w[i]);
+}
+
+/*******************************************************************************
+ * Applies the antenna height-gain functions to the normalized electric field
+ * f(x) of the flat Earth approximation with curvature correction.
+ *
+ * @param[in] fofx     Normalized electric field, from `FlatEarthAttenuation()`
+ * @param[in] delta    Surface impedance
+ * @param[in] h_1__km  Height of the higher antenna, in km
+ * @param[in] h_2__km  Height of the lower antenna, in km
+ * @param[in] k        Wavenumber, in rad/km
+ * @return             Normalized field strength in mV/m
+ ******************************************************************************/
+double FlatEarthHeightGain(
+    const std::complex<double> fofx,
+    const std::complex<double> delta,
+    const double h_1__km,
+    const double h_2__km,
+    const double k
+) {
+    const std::complex<double> j = std::complex<double>(0.0, 1.0);
+
     // Now find the final normalized field strength from f(x) and the height-gain function for each antenna
     // A height-gain function for an antenna is expressed as two terms of a Taylor series
     // (See DeMinco NTIA Report 99-368 Aug 1999
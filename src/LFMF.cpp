@@ -4,8 +4,9 @@
 
 #include "LFMF.h"
 
-#include <cmath>    // for cbrt, exp, fabs, log10, pow, sqrt
-#include <complex>  // for std::complex
+#include <algorithm>  // for std::max, std::min
+#include <cmath>      // for cbrt, exp, fabs, log10, pow, sqrt
+#include <complex>    // for std::complex
 
 namespace ITS {
 namespace Propagation {
@@ -96,23 +97,53 @@ ReturnCode LFMF_CPP(
     if (rtn != SUCCESS)
         return rtn;
 
+    PropagationConstants constants;
+    ComputePropagationConstants(f__mhz, N_s, epsilon, sigma, pol, constants);
+
+    return EvaluateLFMF(
+        constants, h_tx__meter, h_rx__meter, P_tx__watt, d__km, result
+    );
+}
+
+/*******************************************************************************
+ * Compute the intermediate values which depend only on frequency, ground
+ * constants, polarization, and surface refractivity.
+ *
+ * Inputs are assumed to have already been validated.
+ *
+ * @param[in]  f__mhz     Frequency, in MHz
+ * @param[in]  N_s        Surface refractivity, in N-Units
+ * @param[in]  epsilon    Relative permittivity
+ * @param[in]  sigma      Conductivity
+ * @param[in]  pol        Polarization
+ * @param[out] constants  Intermediate values shared by paths with these inputs
+ * 
+ * @see ITS::Propagation::LFMF::PropagationConstants
+ ******************************************************************************/
+void ComputePropagationConstants(
+    const double f__mhz,
+    const double N_s,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    PropagationConstants &constants
+) {
     // Create the complex value j since this was written by electrical engineers
     constexpr std::complex<double> j = std::complex<double>(0.0, 1.0);
 
+    constants.f__mhz = f__mhz;
+    constants.N_s = N_s;
+    constants.epsilon = epsilon;
+    constants.sigma = sigma;
+    constants.pol = pol;
+
     const double f__hz = f__mhz * 1e6;
     const double lambda__meter = C / f__hz;  // wavelength, in meters
 
-    const double h_1__km
-        = std::min(h_tx__meter, h_rx__meter) / 1000;  // lower antenna, in km
-    const double h_2__km
-        = std::max(h_tx__meter, h_rx__meter) / 1000;  // higher antenna, in km
-
     const double a_e__km = a_0__km * 1
                          / (1 - 0.04665 * std::exp(0.005577 * N_s)
                          );  // effective earth radius, in km
 
-    const double theta__rad = d__km / a_e__km;
-
     const double k = 2.0 * PI * 1000 / lambda__meter;  // wavenumber, in rad/km
     const double nu = std::cbrt(a_e__km * k / 2.0);    // Intermediate value nu
 
@@ -125,22 +156,170 @@ ReturnCode LFMF_CPP(
     if (pol == Polarization::VERTICAL)
         delta /= eta;
 
-    const std::complex<double> q = -nu * j * delta;  // intermediate value q
+    constants.f__hz = f__hz;
+    constants.a_e__km = a_e__km;
+    constants.k = k;
+    constants.nu = nu;
+    constants.delta = delta;
+    constants.q = -nu * j * delta;  // intermediate value q
 
     // Determine which smooth earth method is used; SG3 Groundwave Handbook, Eq 15
-    const double d_test__km = 80 / std::cbrt(f__mhz);
+    constants.d_test__km = 80 / std::cbrt(f__mhz);
+}
+
+/*******************************************************************************
+ * Compute the LFMF propagation prediction for one path, using previously
+ * computed intermediate values.
+ *
+ * Inputs are assumed to have already been validated.
+ *
+ * @param[in]  constants    Intermediate values from `ComputePropagationConstants()`
+ * @param[in]  h_tx__meter  Height of the transmitter, in meter
+ * @param[in]  h_rx__meter  Height of the receiver, in meter
+ * @param[in]  P_tx__watt   Transmitter power, in watts
+ * @param[in]  d__km        Path distance, in km
+ * @param[out] result       Result structure
+ * @return                  Return code; `SUCCESS`, or the failure of the
+ *                          residue series to find a root or height-gain function
+ ******************************************************************************/
+ReturnCode EvaluateLFMF(
+    const PropagationConstants &constants,
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double P_tx__watt,
+    const double d__km,
+    Result &result
+) {
+    const double h_1__km
+        = std::min(h_tx__meter, h_rx__meter) / 1000;  // lower antenna, in km
+    const double h_2__km
+        = std::max(h_tx__meter, h_rx__meter) / 1000;  // higher antenna, in km
+
+    const double theta__rad = d__km / constants.a_e__km;
 
     double E_gw;
-    if (d__km < d_test__km) {
+    if (d__km < constants.d_test__km) {
         E_gw = FlatEarthCurveCorrection(
-            delta, q, h_1__km, h_2__km, d__km, k, a_e__km
+            constants.delta,
+            constants.q,
+            h_1__km,
+            h_2__km,
+            d__km,
+            constants.k,
+            constants.a_e__km
         );
         result.method = SolutionMethod::FLAT_EARTH_CURVE;
     } else {
-        E_gw = ResidueSeries(k, h_1__km, h_2__km, nu, theta__rad, q);
+        const ReturnCode rtn = ResidueSeries(
+            constants.k,
+            h_1__km,
+            h_2__km,
+            constants.nu,
+            theta__rad,
+            constants.q,
+            E_gw
+        );
+        if (rtn != SUCCESS)
+            return rtn;
         result.method = SolutionMethod::RESIDUE_SERIES;
     }
 
+    FieldStrengthToResult(constants, E_gw, P_tx__watt, d__km, result);
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Compute the LFMF propagation prediction for one path, finding residue series
+ * roots by continuation from the roots of a nearby path.
+ *
+ * Inputs are assumed to have already been validated. If the residue series is
+ * used and finds any roots, they replace `seed` so that the next, nearby, path
+ * of a sweep may continue from them.
+ *
+ * @param[in]     constants          Intermediate values from
+ *                                   `ComputePropagationConstants()`
+ * @param[in]     h_tx__meter        Height of the transmitter, in meter
+ * @param[in]     h_rx__meter        Height of the receiver, in meter
+ * @param[in]     P_tx__watt         Transmitter power, in watts
+ * @param[in]     d__km              Path distance, in km
+ * @param[in,out] seed               Roots of the last path which found any
+ * @param[in,out] newton_iterations  Incremented by the Newton iterations used
+ * @param[out]    result             Result structure
+ * @return                           Return code, as for `EvaluateLFMF()`
+ *
+ * @see ITS::Propagation::LFMF::SeedResidueSeriesRoots
+ ******************************************************************************/
+ReturnCode EvaluateLFMFContinued(
+    const PropagationConstants &constants,
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double P_tx__watt,
+    const double d__km,
+    ResidueSeriesRoots &seed,
+    long &newton_iterations,
+    Result &result
+) {
+    const double h_1__km
+        = std::min(h_tx__meter, h_rx__meter) / 1000;  // lower antenna, in km
+    const double h_2__km
+        = std::max(h_tx__meter, h_rx__meter) / 1000;  // higher antenna, in km
+
+    double E_gw;
+    if (d__km < constants.d_test__km) {
+        E_gw = FlatEarthCurveCorrection(
+            constants.delta,
+            constants.q,
+            h_1__km,
+            h_2__km,
+            d__km,
+            constants.k,
+            constants.a_e__km
+        );
+        result.method = SolutionMethod::FLAT_EARTH_CURVE;
+    } else {
+        ResidueSeriesModes modes;
+        InitializeResidueSeriesModes(
+            constants.k, h_1__km, h_2__km, constants.nu, constants.q, modes
+        );
+        SeedResidueSeriesRoots(modes.roots, seed);
+
+        const double theta__rad = d__km / constants.a_e__km;
+        E_gw = ResidueSeriesField(modes, constants.nu * theta__rad);
+        result.method = SolutionMethod::RESIDUE_SERIES;
+
+        newton_iterations += modes.roots.newton_iterations;
+        if (modes.roots.status != SUCCESS)
+            return modes.roots.status;
+        if (!modes.roots.T.empty()) {
+            seed.q = modes.roots.q;
+            seed.T.swap(modes.roots.T);
+        }
+    }
+
+    FieldStrengthToResult(constants, E_gw, P_tx__watt, d__km, result);
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Convert a normalized groundwave field strength into the model outputs.
+ *
+ * The solution method in `result` is not modified.
+ *
+ * @param[in]     constants   Intermediate values from `ComputePropagationConstants()`
+ * @param[in]     E_gw        Normalized field strength, in mV/m
+ * @param[in]     P_tx__watt  Transmitter power, in watts
+ * @param[in]     d__km       Path distance, in km
+ * @param[in,out] result      Result structure
+ ******************************************************************************/
+void FieldStrengthToResult(
+    const PropagationConstants &constants,
+    const double E_gw,
+    const double P_tx__watt,
+    const double d__km,
+    Result &result
+) {
+    const double f__hz = constants.f__hz;
+
     // Antenna gains
     constexpr double G_tx__dbi = 4.77;
     constexpr double G_rx__dbi = 4.77;
@@ -150,7 +329,7 @@ ReturnCode LFMF_CPP(
     // Un-normalize the electric field strength
     const double E_0 = std::sqrt(ETA * (P_tx__watt * G_tx) / (4.0 * PI))
                      / d__km;  // V/km or mV/m
-    E_gw = E_gw * E_0;
+    const double E_gw__mVm = E_gw * E_0;
 
     // Calculate the basic transmission loss using (derived using Friis Transmission Equation with Electric Field Strength)
     //      Pt     Gt * Pt * ETA * 4*PI * f^2
@@ -161,17 +340,15 @@ ReturnCode LFMF_CPP(
     //    and Lbtl is a function of 1/E_gw, we add in (Gt * Pt) to remove its effects
     result.A_btl__db = 10 * std::log10(P_tx__watt * G_tx)
                      + 10 * std::log10(ETA * 4 * PI) + 20 * std::log10(f__hz)
-                     - 20 * std::log10(E_gw / 1000) - 20 * std::log10(C);
+                     - 20 * std::log10(E_gw__mVm / 1000) - 20 * std::log10(C);
 
     // the 60 constant comes from converting field strength from mV/m to dB(uV/m) thus 20*log10(1e3)
-    result.E_dBuVm = 60 + 20 * std::log10(E_gw);
+    result.E_dBuVm = 60 + 20 * std::log10(E_gw__mVm);
 
     // Note power is a function of frequency.  42.8 comes from MHz to hz, power in dBm, and the remainder from
     // the collection of constants in the derivation of the below equation.
     result.P_rx__dbm
         = result.E_dBuVm + G_rx__dbi - 20.0 * std::log10(f__hz) + 42.8;
-
-    return SUCCESS;
 }
 
 /*******************************************************************************
@@ -0,0 +1,343 @@
+/** @file LFMFBatch.cpp
+ * Implements the batched, structure-of-arrays entry points of the model.
+ */
+
+#include "LFMF.h"
+
+#include <cstddef>  // for std::size_t
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions for a batch of paths
+ *
+ * Each input is a contiguous array of `n` values, where element `i` of every
+ * array describes the `i`-th path. See `LFMFBatch_CPP()` for details.
+ *
+ * @param[in]  n            Number of paths in the batch
+ * @param[in]  h_tx__meter  Heights of the transmitter, in meter
+ * @param[in]  h_rx__meter  Heights of the receiver, in meter
+ * @param[in]  f__mhz       Frequencies, in MHz
+ * @param[in]  P_tx__watt   Transmitter powers, in watts
+ * @param[in]  N_s          Surface refractivities, in N-Units
+ * @param[in]  d__km        Path distances, in km
+ * @param[in]  epsilon      Relative permittivities
+ * @param[in]  sigma        Conductivities
+ * @param[in]  pol          Polarizations: 0 = Horizontal, 1 = Vertical
+ * @param[out] results      Array of `n` result structures
+ * @param[out] rtns         Array of `n` return codes, one for each path
+ * @return                  `SUCCESS` if every path succeeded, otherwise the
+ *                          return code of the first path which failed
+ * 
+ * @see ITS::Propagation::LFMF::LFMFBatch_CPP
+ ******************************************************************************/
+ReturnCode LFMFBatch(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const int *pol,
+    Result *results,
+    ReturnCode *rtns
+) {
+    // Convert polarizations in fixed-size blocks to avoid a heap allocation
+    constexpr std::size_t BLOCK_SIZE = 256;
+    Polarization pol_block[BLOCK_SIZE];
+
+    ReturnCode rtn = SUCCESS;
+    for (std::size_t start = 0; start < n; start += BLOCK_SIZE) {
+        const std::size_t count
+            = (n - start < BLOCK_SIZE) ? (n - start) : BLOCK_SIZE;
+        for (std::size_t i = 0; i < count; i++)
+            pol_block[i] = static_cast<Polarization>(pol[start + i]);
+
+        const ReturnCode block_rtn = LFMFBatch_CPP(
+            count,
+            h_tx__meter + start,
+            h_rx__meter + start,
+            f__mhz + start,
+            P_tx__watt + start,
+            N_s + start,
+            d__km + start,
+            epsilon + start,
+            sigma + start,
+            pol_block,
+            results + start,
+            rtns + start
+        );
+        if (rtn == SUCCESS)
+            rtn = block_rtn;
+    }
+    return rtn;
+}
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions for a batch of paths, using several
+ * threads
+ *
+ * Each input is a contiguous array of `n` values, where element `i` of every
+ * array describes the `i`-th path. See `LFMFBatchParallel_CPP()` for details.
+ * The threads are taken from the pool returned by `SharedExecutor()`, so
+ * repeated calls with the same thread count reuse the same threads.
+ *
+ * @param[in]  n            Number of paths in the batch
+ * @param[in]  h_tx__meter  Heights of the transmitter, in meter
+ * @param[in]  h_rx__meter  Heights of the receiver, in meter
+ * @param[in]  f__mhz       Frequencies, in MHz
+ * @param[in]  P_tx__watt   Transmitter powers, in watts
+ * @param[in]  N_s          Surface refractivities, in N-Units
+ * @param[in]  d__km        Path distances, in km
+ * @param[in]  epsilon      Relative permittivities
+ * @param[in]  sigma        Conductivities
+ * @param[in]  pol          Polarizations: 0 = Horizontal, 1 = Vertical
+ * @param[out] results      Array of `n` result structures
+ * @param[out] rtns         Array of `n` return codes, one for each path
+ * @param[in]  n_threads    Number of threads; 0 uses one thread for each
+ *                          hardware thread
+ * @param[in]  chunk_size   Number of paths evaluated together by one thread;
+ *                          0 chooses a size automatically
+ * @return                  `SUCCESS` if every path succeeded, otherwise the
+ *                          return code of the first path which failed, or
+ *                          `ERROR__EXECUTION` for every path if the threads
+ *                          could not be started
+ * 
+ * @see ITS::Propagation::LFMF::LFMFBatchParallel_CPP
+ ******************************************************************************/
+ReturnCode LFMFBatchParallel(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const int *pol,
+    Result *results,
+    ReturnCode *rtns,
+    const unsigned int n_threads,
+    const std::size_t chunk_size
+) {
+    const auto body = [&](const std::size_t begin, const std::size_t end) {
+        LFMFBatch(
+            end - begin,
+            h_tx__meter + begin,
+            h_rx__meter + begin,
+            f__mhz + begin,
+            P_tx__watt + begin,
+            N_s + begin,
+            d__km + begin,
+            epsilon + begin,
+            sigma + begin,
+            pol + begin,
+            results + begin,
+            rtns + begin
+        );
+    };
+
+#ifdef LFMF_NO_EXCEPTIONS
+    SharedExecutor(n_threads).ParallelFor(n, chunk_size, body);
+#else
+    // Exceptions must not cross the C interface
+    try {
+        SharedExecutor(n_threads).ParallelFor(n, chunk_size, body);
+    } catch (...) {
+        for (std::size_t i = 0; i < n; i++)
+            rtns[i] = ERROR__EXECUTION;
+        return ERROR__EXECUTION;
+    }
+#endif
+
+    for (std::size_t i = 0; i < n; i++) {
+        if (rtns[i] != SUCCESS)
+            return rtns[i];
+    }
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions for a batch of paths
+ *
+ * Each input is a contiguous array of `n` values, where element `i` of every
+ * array describes the `i`-th path. The result and return code of path `i` are
+ * written to `results[i]` and `rtns[i]`, and every path is evaluated: an
+ * invalid path is reported in `rtns` and does not stop the batch. The contents
+ * of `results[i]` are unspecified when `rtns[i]` is not `SUCCESS`.
+ *
+ * The intermediate values which depend only on frequency, ground constants,
+ * polarization, and surface refractivity are computed once for each run of
+ * consecutive paths sharing those inputs. Ordering a batch so that such paths
+ * are adjacent maximizes this reuse.
+ *
+ * @param[in]  n            Number of paths in the batch
+ * @param[in]  h_tx__meter  Heights of the transmitter, in meter
+ * @param[in]  h_rx__meter  Heights of the receiver, in meter
+ * @param[in]  f__mhz       Frequencies, in MHz
+ * @param[in]  P_tx__watt   Transmitter powers, in watts
+ * @param[in]  N_s          Surface refractivities, in N-Units
+ * @param[in]  d__km        Path distances, in km
+ * @param[in]  epsilon      Relative permittivities
+ * @param[in]  sigma        Conductivities
+ * @param[in]  pol          Polarizations
+ * @param[out] results      Array of `n` result structures
+ * @param[out] rtns         Array of `n` return codes, one for each path
+ * @return                  `SUCCESS` if every path succeeded, otherwise the
+ *                          return code of the first path which failed
+ * 
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ * @see ITS::Propagation::LFMF::PropagationConstants
+ ******************************************************************************/
+ReturnCode LFMFBatch_CPP(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const Polarization *pol,
+    Result *results,
+    ReturnCode *rtns
+) {
+    ReturnCode batch_rtn = SUCCESS;
+
+    PropagationConstants constants;
+    bool constants_valid = false;  // True once `constants` has been computed
+
+    for (std::size_t i = 0; i < n; i++) {
+        ReturnCode rtn = ValidateInput(
+            h_tx__meter[i],
+            h_rx__meter[i],
+            f__mhz[i],
+            P_tx__watt[i],
+            N_s[i],
+            d__km[i],
+            epsilon[i],
+            sigma[i]
+        );
+        if (rtn == SUCCESS)
+            rtn = ValidatePolarization(pol[i]);
+
+        rtns[i] = rtn;
+        if (rtn != SUCCESS) {
+            // Record the first failure, but keep evaluating the batch
+            if (batch_rtn == SUCCESS)
+                batch_rtn = rtn;
+            continue;
+        }
+
+        // Only recompute the intermediate values when they would change
+        if (!constants_valid || constants.f__mhz != f__mhz[i]
+            || constants.N_s != N_s[i] || constants.epsilon != epsilon[i]
+            || constants.sigma != sigma[i] || constants.pol != pol[i]) {
+            ComputePropagationConstants(
+                f__mhz[i], N_s[i], epsilon[i], sigma[i], pol[i], constants
+            );
+            constants_valid = true;
+        }
+
+        rtn = EvaluateLFMF(
+            constants,
+            h_tx__meter[i],
+            h_rx__meter[i],
+            P_tx__watt[i],
+            d__km[i],
+            results[i]
+        );
+
+        rtns[i] = rtn;
+        if (rtn != SUCCESS && batch_rtn == SUCCESS)
+            batch_rtn = rtn;
+    }
+
+    return batch_rtn;
+}
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions for a batch of paths, using the
+ * threads of an executor
+ *
+ * The batch is divided into chunks of consecutive paths, and each chunk is
+ * evaluated by `LFMFBatch_CPP()`. Results are identical to those of
+ * `LFMFBatch_CPP()`, regardless of the number of threads or the chunk size.
+ * Larger chunks reuse intermediate values across more paths, while smaller
+ * chunks balance uneven work between threads more finely.
+ *
+ * @param[in]     n            Number of paths in the batch
+ * @param[in]     h_tx__meter  Heights of the transmitter, in meter
+ * @param[in]     h_rx__meter  Heights of the receiver, in meter
+ * @param[in]     f__mhz       Frequencies, in MHz
+ * @param[in]     P_tx__watt   Transmitter powers, in watts
+ * @param[in]     N_s          Surface refractivities, in N-Units
+ * @param[in]     d__km        Path distances, in km
+ * @param[in]     epsilon      Relative permittivities
+ * @param[in]     sigma        Conductivities
+ * @param[in]     pol          Polarizations
+ * @param[out]    results      Array of `n` result structures
+ * @param[out]    rtns         Array of `n` return codes, one for each path
+ * @param[in,out] executor     Thread pool used to evaluate the batch
+ * @param[in]     chunk_size   Number of paths evaluated together by one
+ *                             thread; 0 chooses a size automatically
+ * @return                     `SUCCESS` if every path succeeded, otherwise the
+ *                             return code of the first path which failed
+ * 
+ * @see ITS::Propagation::LFMF::LFMFBatch_CPP
+ * @see ITS::Propagation::LFMF::Executor
+ ******************************************************************************/
+ReturnCode LFMFBatchParallel_CPP(
+    const std::size_t n,
+    const double *h_tx__meter,
+    const double *h_rx__meter,
+    const double *f__mhz,
+    const double *P_tx__watt,
+    const double *N_s,
+    const double *d__km,
+    const double *epsilon,
+    const double *sigma,
+    const Polarization *pol,
+    Result *results,
+    ReturnCode *rtns,
+    Executor &executor,
+    const std::size_t chunk_size
+) {
+    executor.ParallelFor(
+        n,
+        chunk_size,
+        [&](const std::size_t begin, const std::size_t end) {
+            LFMFBatch_CPP(
+                end - begin,
+                h_tx__meter + begin,
+                h_rx__meter + begin,
+                f__mhz + begin,
+                P_tx__watt + begin,
+                N_s + begin,
+                d__km + begin,
+                epsilon + begin,
+                sigma + begin,
+                pol + begin,
+                results + begin,
+                rtns + begin
+            );
+        }
+    );
+
+    for (std::size_t i = 0; i < n; i++) {
+        if (rtns[i] != SUCCESS)
+            return rtns[i];
+    }
+    return SUCCESS;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
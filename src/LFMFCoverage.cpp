@@ -0,0 +1,123 @@
+/** @file LFMFCoverage.cpp
+ * Implements a function to compute the model over a polar grid around a
+ * transmitter, using several threads.
+ */
+
+#include "LFMF.h"
+
+#include <algorithm>  // for std::max
+#include <cstddef>    // for std::size_t
+#include <limits>     // for std::numeric_limits
+#include <vector>     // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions over a polar grid around a transmitter.
+ *
+ * Each radial has its own ground constants and distances. A radial is a
+ * distance sweep, so the residue series roots and height-gain functions of a
+ * radial are found once and summed at each of its distances. Radials are
+ * shared between the threads of the pool returned by `SharedExecutor()`, which
+ * steals work so that threads given cheaper radials help with the rest.
+ *
+ * Every cell is evaluated: an invalid input, or a failure to find a residue
+ * series root, is reported in `grid.rtns` and does not stop the computation.
+ * The results of a cell are unspecified when its return code is not
+ * `SUCCESS`.
+ *
+ * @param[in]  h_tx__meter  Height of the transmitter, in meter
+ * @param[in]  h_rx__meter  Height of the receiver, in meter
+ * @param[in]  f__mhz       Frequency, in MHz
+ * @param[in]  P_tx__watt   Transmitter power, in watts
+ * @param[in]  N_s          Surface refractivity, in N-Units
+ * @param[in]  pol          Polarization
+ * @param[in]  radials      Ground constants and distances of each radial
+ * @param[in]  n_threads    Number of threads to use; 0 uses one thread for
+ *                          each hardware thread
+ * @param[out] grid         Predictions for every cell of the grid
+ * @return                  `SUCCESS` if every cell succeeded, otherwise the
+ *                          return code of the first cell which failed, in
+ *                          storage order
+ *
+ * @see ITS::Propagation::LFMF::LFMFDistanceSweep
+ * @see ITS::Propagation::LFMF::CoverageGrid
+ * @see ITS::Propagation::LFMF::SharedExecutor
+ ******************************************************************************/
+ReturnCode LFMFCoverage(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const Polarization pol,
+    const std::vector<CoverageRadial> &radials,
+    const unsigned int n_threads,
+    CoverageGrid &grid
+) {
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    grid.n_radials = radials.size();
+    grid.n_distances = 0;
+    for (const CoverageRadial &radial : radials)
+        grid.n_distances = std::max(grid.n_distances, radial.d__km.size());
+
+    const std::size_t n_cells = grid.n_radials * grid.n_distances;
+    grid.d__km.assign(n_cells, NaN);
+    grid.E_dBuVm.assign(n_cells, NaN);
+    grid.A_btl__db.assign(n_cells, NaN);
+    grid.P_rx__dbm.assign(n_cells, NaN);
+    grid.rtns.assign(n_cells, SUCCESS);
+
+    // Evaluate one radial and copy it into its row of the grid
+    const auto evaluate_radial = [&](const std::size_t i) {
+        const CoverageRadial &radial = radials[i];
+        std::vector<Result> results;
+        std::vector<ReturnCode> rtns;
+        LFMFDistanceSweep(
+            h_tx__meter,
+            h_rx__meter,
+            f__mhz,
+            P_tx__watt,
+            N_s,
+            radial.d__km,
+            radial.epsilon,
+            radial.sigma,
+            pol,
+            results,
+            rtns
+        );
+
+        const std::size_t row = i * grid.n_distances;
+        for (std::size_t j = 0; j < radial.d__km.size(); j++) {
+            grid.d__km[row + j] = radial.d__km[j];
+            grid.rtns[row + j] = rtns[j];
+            if (rtns[j] == SUCCESS) {
+                grid.E_dBuVm[row + j] = results[j].E_dBuVm;
+                grid.A_btl__db[row + j] = results[j].A_btl__db;
+                grid.P_rx__dbm[row + j] = results[j].P_rx__dbm;
+            }
+        }
+    };
+
+    SharedExecutor(n_threads).ParallelFor(
+        grid.n_radials,
+        1,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                evaluate_radial(i);
+        }
+    );
+
+    for (const ReturnCode rtn : grid.rtns) {
+        if (rtn != SUCCESS)
+            return rtn;
+    }
+    return SUCCESS;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
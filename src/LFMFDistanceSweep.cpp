@@ -0,0 +1,179 @@
+/** @file LFMFDistanceSweep.cpp
+ * Implements a function to compute the model over a set of path distances.
+ */
+
+#include "LFMF.h"
+
+#include <algorithm>  // for std::max, std::min
+#include <complex>    // for std::complex
+#include <cstddef>    // for std::size_t
+#include <vector>     // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions at many path distances, with all other
+ * inputs held fixed.
+ *
+ * The residue series roots, height-gain functions, and distance factor
+ * coefficients depend only on the inputs which are held fixed, so they are
+ * computed once and summed at every distance which uses the residue series
+ * together, by `ResidueSeriesFields()`.
+ * Distances shorter than the crossover distance use the flat earth with
+ * curvature correction method, as in `LFMF_CPP()`, with the Faddeeva function
+ * of all of them evaluated at once by the batch `wofz()`.
+ *
+ * Every distance is evaluated: an invalid input is reported in `rtns` and does
+ * not stop the sweep. The contents of `results[i]` are unspecified when
+ * `rtns[i]` is not `SUCCESS`.
+ *
+ * @param[in]  h_tx__meter  Height of the transmitter, in meter
+ * @param[in]  h_rx__meter  Height of the receiver, in meter
+ * @param[in]  f__mhz       Frequency, in MHz
+ * @param[in]  P_tx__watt   Transmitter power, in watts
+ * @param[in]  N_s          Surface refractivity, in N-Units
+ * @param[in]  d__km        Path distances, in km
+ * @param[in]  epsilon      Relative permittivity
+ * @param[in]  sigma        Conductivity
+ * @param[in]  pol          Polarization
+ * @param[out] results      Result structures, one for each distance
+ * @param[out] rtns         Return codes, one for each distance
+ * @return                  `SUCCESS` if every distance succeeded, otherwise
+ *                          the return code of the first distance which failed
+ * 
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ * @see ITS::Propagation::LFMF::ResidueSeriesModes
+ ******************************************************************************/
+ReturnCode LFMFDistanceSweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const std::vector<double> &d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns
+) {
+    const std::size_t n = d__km.size();
+    results.resize(n);
+    rtns.resize(n);
+
+    ReturnCode sweep_rtn = SUCCESS;
+
+    const double h_1__km
+        = std::min(h_tx__meter, h_rx__meter) / 1000;  // lower antenna, in km
+    const double h_2__km
+        = std::max(h_tx__meter, h_rx__meter) / 1000;  // higher antenna, in km
+
+    PropagationConstants constants;
+    ResidueSeriesModes modes;
+    bool initialized = false;  // True once `constants` and `modes` are set up
+
+    std::vector<std::size_t> fe_index;  // Distances using the flat earth method
+    std::vector<double> fe_d__km;       // Path distance of each of them
+    std::vector<std::size_t> rs_index;  // Distances using the residue series
+    std::vector<double> rs_x;           // Normalized distance of each of them
+
+    for (std::size_t i = 0; i < n; i++) {
+        ReturnCode rtn = ValidateInput(
+            h_tx__meter,
+            h_rx__meter,
+            f__mhz,
+            P_tx__watt,
+            N_s,
+            d__km[i],
+            epsilon,
+            sigma
+        );
+        if (rtn == SUCCESS)
+            rtn = ValidatePolarization(pol);
+
+        rtns[i] = rtn;
+        if (rtn != SUCCESS) {
+            // Record the first failure, but keep evaluating the sweep
+            if (sweep_rtn == SUCCESS)
+                sweep_rtn = rtn;
+            continue;
+        }
+
+        if (!initialized) {
+            ComputePropagationConstants(
+                f__mhz, N_s, epsilon, sigma, pol, constants
+            );
+            InitializeResidueSeriesModes(
+                constants.k,
+                h_1__km,
+                h_2__km,
+                constants.nu,
+                constants.q,
+                modes
+            );
+            initialized = true;
+        }
+
+        if (d__km[i] < constants.d_test__km) {
+            // Evaluated together with the other short distances below
+            fe_index.push_back(i);
+            fe_d__km.push_back(d__km[i]);
+            results[i].method = SolutionMethod::FLAT_EARTH_CURVE;
+        } else {
+            // Summed together with the other residue series distances below
+            const double theta__rad = d__km[i] / constants.a_e__km;
+            rs_index.push_back(i);
+            rs_x.push_back(constants.nu * theta__rad);
+            results[i].method = SolutionMethod::RESIDUE_SERIES;
+        }
+    }
+
+    if (!initialized)
+        return sweep_rtn;
+
+    std::vector<std::complex<double>> fofx(fe_d__km.size());
+    FlatEarthAttenuation(
+        constants.delta,
+        constants.q,
+        fe_d__km.size(),
+        fe_d__km.data(),
+        constants.k,
+        constants.a_e__km,
+        fofx.data()
+    );
+    for (std::size_t r = 0; r < fe_index.size(); r++) {
+        const std::size_t i = fe_index[r];
+        const double E_gw = FlatEarthHeightGain(
+            fofx[r], constants.delta, h_1__km, h_2__km, constants.k
+        );
+        FieldStrengthToResult(
+            constants, E_gw, P_tx__watt, d__km[i], results[i]
+        );
+    }
+
+    std::vector<double> rs_E_gw(rs_x.size());
+    ResidueSeriesFields(modes, rs_x.size(), rs_x.data(), rs_E_gw.data());
+    for (std::size_t r = 0; r < rs_index.size(); r++) {
+        const std::size_t i = rs_index[r];
+        if (modes.roots.status != SUCCESS) {
+            rtns[i] = modes.roots.status;
+            continue;
+        }
+        FieldStrengthToResult(
+            constants, rs_E_gw[r], P_tx__watt, d__km[i], results[i]
+        );
+    }
+
+    // Report the first failure in storage order
+    for (const ReturnCode rtn : rtns) {
+        if (rtn != SUCCESS)
+            return rtn;
+    }
+    return SUCCESS;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
@@ -0,0 +1,119 @@
+/** @file LFMFFrequencySweep.cpp
+ * Implements a function to compute the model over a set of frequencies.
+ */
+
+#include "LFMF.h"
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions at many frequencies, with all other
+ * inputs held fixed.
+ *
+ * The intermediate value q changes smoothly with frequency, so each residue
+ * series root is found by continuation from the same root at the previous
+ * frequency which used the residue series, rather than from the Airy zeros.
+ * Frequencies should be ordered (increasing or decreasing) for the roots to
+ * be close; unordered frequencies give the same results, but save less work.
+ * Roots found by continuation agree with those found by `WiRoot()` to within
+ * the convergence tolerance of Newton's method.
+ *
+ * Every frequency is evaluated: an invalid input is reported in `rtns` and
+ * does not stop the sweep. The contents of `results[i]` are unspecified when
+ * `rtns[i]` is not `SUCCESS`.
+ *
+ * @param[in]  h_tx__meter        Height of the transmitter, in meter
+ * @param[in]  h_rx__meter        Height of the receiver, in meter
+ * @param[in]  f__mhz             Frequencies, in MHz
+ * @param[in]  P_tx__watt         Transmitter power, in watts
+ * @param[in]  N_s                Surface refractivity, in N-Units
+ * @param[in]  d__km              Path distance, in km
+ * @param[in]  epsilon            Relative permittivity
+ * @param[in]  sigma              Conductivity
+ * @param[in]  pol                Polarization
+ * @param[out] results            Result structures, one for each frequency
+ * @param[out] rtns               Return codes, one for each frequency
+ * @param[out] newton_iterations  Total Newton iterations used to find roots
+ * @return                        `SUCCESS` if every frequency succeeded,
+ *                                otherwise the return code of the first
+ *                                frequency which failed
+ *
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ * @see ITS::Propagation::LFMF::EvaluateLFMFContinued
+ ******************************************************************************/
+ReturnCode LFMFFrequencySweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const std::vector<double> &f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const double d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns,
+    long &newton_iterations
+) {
+    const std::size_t n = f__mhz.size();
+    results.resize(n);
+    rtns.resize(n);
+    newton_iterations = 0;
+
+    ReturnCode sweep_rtn = SUCCESS;
+
+    ResidueSeriesRoots seed;  // Roots at the last frequency which found any
+
+    for (std::size_t i = 0; i < n; i++) {
+        ReturnCode rtn = ValidateInput(
+            h_tx__meter,
+            h_rx__meter,
+            f__mhz[i],
+            P_tx__watt,
+            N_s,
+            d__km,
+            epsilon,
+            sigma
+        );
+        if (rtn == SUCCESS)
+            rtn = ValidatePolarization(pol);
+
+        rtns[i] = rtn;
+        if (rtn != SUCCESS) {
+            // Record the first failure, but keep evaluating the sweep
+            if (sweep_rtn == SUCCESS)
+                sweep_rtn = rtn;
+            continue;
+        }
+
+        PropagationConstants constants;
+        ComputePropagationConstants(
+            f__mhz[i], N_s, epsilon, sigma, pol, constants
+        );
+        rtn = EvaluateLFMFContinued(
+            constants,
+            h_tx__meter,
+            h_rx__meter,
+            P_tx__watt,
+            d__km,
+            seed,
+            newton_iterations,
+            results[i]
+        );
+
+        rtns[i] = rtn;
+        if (rtn != SUCCESS && sweep_rtn == SUCCESS)
+            sweep_rtn = rtn;
+    }
+
+    return sweep_rtn;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
@@ -0,0 +1,126 @@
+/** @file LFMFGroundSweep.cpp
+ * Implements a function to compute the model over a grid of ground constants.
+ */
+
+#include "LFMF.h"
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions over a grid of ground constants, with
+ * all other inputs held fixed.
+ *
+ * The intermediate value q changes smoothly with the ground constants, so
+ * each residue series root is found by continuation from the same root at a
+ * neighbouring grid point. The grid is traversed row by row, alternating the
+ * direction of each row of `sigma` values, so that consecutive grid points
+ * are always neighbours. Each axis should be ordered (increasing or
+ * decreasing) for the roots to be close; unordered values give the same
+ * results, but save less work. Roots found by continuation agree with those
+ * found by `WiRoot()` to within the convergence tolerance of Newton's method.
+ *
+ * Results are stored with the `sigma` index varying fastest:
+ * `results[i * sigma.size() + j]` is the prediction for `epsilon[i]` and
+ * `sigma[j]`, and likewise for `rtns`.
+ *
+ * Every grid point is evaluated: an invalid input is reported in `rtns` and
+ * does not stop the sweep. The contents of a result are unspecified when its
+ * return code is not `SUCCESS`.
+ *
+ * @param[in]  h_tx__meter        Height of the transmitter, in meter
+ * @param[in]  h_rx__meter        Height of the receiver, in meter
+ * @param[in]  f__mhz             Frequency, in MHz
+ * @param[in]  P_tx__watt         Transmitter power, in watts
+ * @param[in]  N_s                Surface refractivity, in N-Units
+ * @param[in]  d__km              Path distance, in km
+ * @param[in]  epsilon            Relative permittivities, one for each row
+ * @param[in]  sigma              Conductivities, one for each column
+ * @param[in]  pol                Polarization
+ * @param[out] results            Result structures, one for each grid point
+ * @param[out] rtns               Return codes, one for each grid point
+ * @param[out] newton_iterations  Total Newton iterations used to find roots
+ * @return                        `SUCCESS` if every grid point succeeded,
+ *                                otherwise the return code of the first grid
+ *                                point which failed, in storage order
+ *
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ * @see ITS::Propagation::LFMF::EvaluateLFMFContinued
+ ******************************************************************************/
+ReturnCode LFMFGroundSweep(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const double d__km,
+    const std::vector<double> &epsilon,
+    const std::vector<double> &sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns,
+    long &newton_iterations
+) {
+    const std::size_t n_eps = epsilon.size();
+    const std::size_t n_sigma = sigma.size();
+    results.resize(n_eps * n_sigma);
+    rtns.resize(n_eps * n_sigma);
+    newton_iterations = 0;
+
+    ResidueSeriesRoots seed;  // Roots at the last grid point which found any
+
+    for (std::size_t i = 0; i < n_eps; i++) {
+        for (std::size_t jj = 0; jj < n_sigma; jj++) {
+            // Alternate direction so the previous grid point is a neighbour
+            const std::size_t j = (i % 2 == 0) ? jj : n_sigma - 1 - jj;
+            const std::size_t idx = i * n_sigma + j;
+
+            ReturnCode rtn = ValidateInput(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                P_tx__watt,
+                N_s,
+                d__km,
+                epsilon[i],
+                sigma[j]
+            );
+            if (rtn == SUCCESS)
+                rtn = ValidatePolarization(pol);
+
+            rtns[idx] = rtn;
+            if (rtn != SUCCESS)
+                continue;
+
+            PropagationConstants constants;
+            ComputePropagationConstants(
+                f__mhz, N_s, epsilon[i], sigma[j], pol, constants
+            );
+            rtns[idx] = EvaluateLFMFContinued(
+                constants,
+                h_tx__meter,
+                h_rx__meter,
+                P_tx__watt,
+                d__km,
+                seed,
+                newton_iterations,
+                results[idx]
+            );
+        }
+    }
+
+    // Report the first failure in storage order, not traversal order
+    for (const ReturnCode rtn : rtns) {
+        if (rtn != SUCCESS)
+            return rtn;
+    }
+    return SUCCESS;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
@@ -0,0 +1,172 @@
+/** @file LFMFHeightSweep.cpp
+ * Implements a function to compute the model over a set of receiver heights.
+ */
+
+#include "LFMF.h"
+
+#include <algorithm>  // for std::max, std::min
+#include <complex>    // for std::complex
+#include <cstddef>    // for std::size_t
+#include <vector>     // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Compute LFMF propagation predictions for many receiver heights, optionally
+ * at many path distances, with all other inputs held fixed.
+ *
+ * Results are computed for every combination of receiver height and path
+ * distance, and are stored height-major: the result for `h_rx__meter[i]` and
+ * `d__km[j]` is `results[i * d__km.size() + j]`.
+ *
+ * The residue series roots and the transmitter height-gain function are
+ * computed once, so each receiver height only evaluates its own height-gain
+ * function. For distances which use the flat earth with curvature correction
+ * method, the normalized field f(x) is computed once for each distance and
+ * only the antenna height-gain factor (Eq. 36, NTIA Report 99-368) is
+ * evaluated for each receiver height.
+ *
+ * Every combination is evaluated: an invalid input is reported in `rtns` and
+ * does not stop the sweep. The contents of a result are unspecified when its
+ * return code is not `SUCCESS`.
+ *
+ * @param[in]  h_tx__meter  Height of the transmitter, in meter
+ * @param[in]  h_rx__meter  Heights of the receiver, in meter
+ * @param[in]  f__mhz       Frequency, in MHz
+ * @param[in]  P_tx__watt   Transmitter power, in watts
+ * @param[in]  N_s          Surface refractivity, in N-Units
+ * @param[in]  d__km        Path distances, in km
+ * @param[in]  epsilon      Relative permittivity
+ * @param[in]  sigma        Conductivity
+ * @param[in]  pol          Polarization
+ * @param[out] results      Result structures, one for each combination
+ * @param[out] rtns         Return codes, one for each combination
+ * @return                  `SUCCESS` if every combination succeeded, otherwise
+ *                          the return code of the first one which failed
+ * 
+ * @see ITS::Propagation::LFMF::LFMF_CPP
+ * @see ITS::Propagation::LFMF::LFMFDistanceSweep
+ ******************************************************************************/
+ReturnCode LFMFHeightSweep(
+    const double h_tx__meter,
+    const std::vector<double> &h_rx__meter,
+    const double f__mhz,
+    const double P_tx__watt,
+    const double N_s,
+    const std::vector<double> &d__km,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol,
+    std::vector<Result> &results,
+    std::vector<ReturnCode> &rtns
+) {
+    const std::size_t n_h = h_rx__meter.size();
+    const std::size_t n_d = d__km.size();
+    results.resize(n_h * n_d);
+    rtns.resize(n_h * n_d);
+
+    ReturnCode sweep_rtn = SUCCESS;
+
+    PropagationConstants constants;
+    ResidueSeriesModes modes;
+    bool initialized = false;  // True once `constants` and `modes` are set up
+
+    // Flat earth normalized field f(x) for each distance, found when first used
+    std::vector<std::complex<double>> fofx(n_d);
+    std::vector<bool> fofx_valid(n_d, false);
+
+    for (std::size_t i = 0; i < n_h; i++) {
+        const double h_1__km = std::min(h_tx__meter, h_rx__meter[i])
+                             / 1000;  // lower antenna, in km
+        const double h_2__km = std::max(h_tx__meter, h_rx__meter[i])
+                             / 1000;  // higher antenna, in km
+
+        for (std::size_t j = 0; j < n_d; j++) {
+            const std::size_t idx = i * n_d + j;
+
+            ReturnCode rtn = ValidateInput(
+                h_tx__meter,
+                h_rx__meter[i],
+                f__mhz,
+                P_tx__watt,
+                N_s,
+                d__km[j],
+                epsilon,
+                sigma
+            );
+            if (rtn == SUCCESS)
+                rtn = ValidatePolarization(pol);
+
+            rtns[idx] = rtn;
+            if (rtn != SUCCESS) {
+                // Record the first failure, but keep evaluating the sweep
+                if (sweep_rtn == SUCCESS)
+                    sweep_rtn = rtn;
+                continue;
+            }
+
+            if (!initialized) {
+                ComputePropagationConstants(
+                    f__mhz, N_s, epsilon, sigma, pol, constants
+                );
+                // The first antenna is the transmitter, so that its
+                // height-gain function is kept as the receiver height changes
+                InitializeResidueSeriesModes(
+                    constants.k,
+                    h_tx__meter / 1000,
+                    h_rx__meter[i] / 1000,
+                    constants.nu,
+                    constants.q,
+                    modes
+                );
+                initialized = true;
+            }
+
+            double E_gw;
+            if (d__km[j] < constants.d_test__km) {
+                if (!fofx_valid[j]) {
+                    fofx[j] = FlatEarthAttenuation(
+                        constants.delta,
+                        constants.q,
+                        d__km[j],
+                        constants.k,
+                        constants.a_e__km
+                    );
+                    fofx_valid[j] = true;
+                }
+                E_gw = FlatEarthHeightGain(
+                    fofx[j], constants.delta, h_1__km, h_2__km, constants.k
+                );
+                results[idx].method = SolutionMethod::FLAT_EARTH_CURVE;
+            } else {
+                UpdateResidueSeriesHeights(
+                    modes,
+                    constants.k * (h_tx__meter / 1000) / constants.nu,
+                    constants.k * (h_rx__meter[i] / 1000) / constants.nu
+                );
+                const double theta__rad = d__km[j] / constants.a_e__km;
+                E_gw = ResidueSeriesField(modes, constants.nu * theta__rad);
+                results[idx].method = SolutionMethod::RESIDUE_SERIES;
+
+                if (modes.roots.status != SUCCESS) {
+                    rtns[idx] = modes.roots.status;
+                    if (sweep_rtn == SUCCESS)
+                        sweep_rtn = modes.roots.status;
+                    continue;
+                }
+            }
+
+            FieldStrengthToResult(
+                constants, E_gw, P_tx__watt, d__km[j], results[idx]
+            );
+        }
+    }
+
+    return sweep_rtn;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
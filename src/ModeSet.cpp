@@ -0,0 +1,171 @@
+/** @file ModeSet.cpp
+ * Implements a reusable set of residue series modes.
+ */
+
+#include "LFMF.h"
+
+#include <algorithm>  // for std::max, std::min
+#include <cstddef>    // for std::size_t
+#include <mutex>      // for std::lock_guard
+#include <vector>     // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+/*******************************************************************************
+ * Build a mode set for the given path-independent inputs.
+ *
+ * Invalid inputs do not throw; they are reported by `GetStatus()` and by every
+ * call to `Evaluate()`.
+ *
+ * @param[in] f__mhz   Frequency, in MHz
+ * @param[in] N_s      Surface refractivity, in N-Units
+ * @param[in] epsilon  Relative permittivity
+ * @param[in] sigma    Conductivity
+ * @param[in] pol      Polarization
+ ******************************************************************************/
+ModeSet::ModeSet(
+    const double f__mhz,
+    const double N_s,
+    const double epsilon,
+    const double sigma,
+    const Polarization pol
+) {
+    status = ValidateModeSetInput(f__mhz, N_s, epsilon, sigma);
+    if (status == SUCCESS)
+        status = ValidatePolarization(pol);
+
+    if (status == SUCCESS) {
+        ComputePropagationConstants(
+            f__mhz, N_s, epsilon, sigma, pol, constants
+        );
+    } else {
+        // Keep the inputs so that Evaluate() reports errors as LFMF_CPP() does
+        constants = PropagationConstants();
+        constants.f__mhz = f__mhz;
+        constants.N_s = N_s;
+        constants.epsilon = epsilon;
+        constants.sigma = sigma;
+        constants.pol = pol;
+    }
+    roots.q = constants.q;
+}
+
+/*******************************************************************************
+ * Get the result of validating the inputs of the mode set.
+ *
+ * @return  `SUCCESS`, or the return code `LFMF_CPP()` gives for the first
+ *          invalid path-independent input
+ ******************************************************************************/
+ReturnCode ModeSet::GetStatus() const {
+    return status;
+}
+
+/*******************************************************************************
+ * Get the intermediate values of the mode set. Only the inputs are set when
+ * `GetStatus()` is not `SUCCESS`.
+ *
+ * @return  Intermediate values
+ ******************************************************************************/
+const PropagationConstants &ModeSet::GetConstants() const {
+    return constants;
+}
+
+/*******************************************************************************
+ * Get the residue series roots found so far.
+ *
+ * @param[out] T   Roots t_i of Wi'(t) - q*Wi(t) = 0
+ * @param[out] W1  Wi(t_i) at each root
+ ******************************************************************************/
+void ModeSet::GetRoots(
+    std::vector<std::complex<double>> &T, std::vector<std::complex<double>> &W1
+) const {
+    std::lock_guard<std::mutex> lock(roots_mutex);
+    T = roots.T;
+    W1 = roots.W1;
+}
+
+/*******************************************************************************
+ * Compute the LFMF propagation prediction for one path.
+ *
+ * Roots found by any call are kept for later calls. Concurrent calls may both
+ * find the same new roots; the longer set of roots is kept.
+ *
+ * @param[in]  h_tx__meter  Height of the transmitter, in meter
+ * @param[in]  h_rx__meter  Height of the receiver, in meter
+ * @param[in]  P_tx__watt   Transmitter power, in watts
+ * @param[in]  d__km        Path distance, in km
+ * @param[out] result       Result structure
+ * @return                  Return code, as given by `LFMF_CPP()`
+ ******************************************************************************/
+ReturnCode ModeSet::Evaluate(
+    const double h_tx__meter,
+    const double h_rx__meter,
+    const double P_tx__watt,
+    const double d__km,
+    Result &result
+) const {
+    ReturnCode rtn = ValidateInput(
+        h_tx__meter,
+        h_rx__meter,
+        constants.f__mhz,
+        P_tx__watt,
+        constants.N_s,
+        d__km,
+        constants.epsilon,
+        constants.sigma
+    );
+    if (rtn != SUCCESS)
+        return rtn;
+    rtn = ValidatePolarization(constants.pol);
+    if (rtn != SUCCESS)
+        return rtn;
+
+    if (d__km < constants.d_test__km) {
+        return EvaluateLFMF(
+            constants, h_tx__meter, h_rx__meter, P_tx__watt, d__km, result
+        );
+    }
+
+    const double h_1__km
+        = std::min(h_tx__meter, h_rx__meter) / 1000;  // lower antenna, in km
+    const double h_2__km
+        = std::max(h_tx__meter, h_rx__meter) / 1000;  // higher antenna, in km
+
+    ResidueSeriesModes modes;
+    InitializeResidueSeriesModes(
+        constants.k, h_1__km, h_2__km, constants.nu, constants.q, modes
+    );
+    {
+        std::lock_guard<std::mutex> lock(roots_mutex);
+        modes.roots.T = roots.T;
+        modes.roots.W1 = roots.W1;
+        modes.roots.n_cached = roots.n_cached;
+    }
+    const std::size_t n_known = modes.roots.T.size();
+
+    const double theta__rad = d__km / constants.a_e__km;
+    const double E_gw = ResidueSeriesField(modes, constants.nu * theta__rad);
+    result.method = SolutionMethod::RESIDUE_SERIES;
+
+    if (modes.roots.T.size() > n_known) {
+        std::lock_guard<std::mutex> lock(roots_mutex);
+        if (modes.roots.T.size() > roots.T.size()) {
+            roots.T.swap(modes.roots.T);
+            roots.W1.swap(modes.roots.W1);
+            roots.n_cached = modes.roots.n_cached;
+        }
+    }
+
+    if (modes.roots.status != SUCCESS)
+        return modes.roots.status;
+
+    FieldStrengthToResult(constants, E_gw, P_tx__watt, d__km, result);
+
+    return SUCCESS;
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
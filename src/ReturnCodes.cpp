@@ -40,6 +40,15 @@ std::string GetReturnStatus(int code) {
         {ERROR__EPSILON, "Epsilon is out of range"},
         {ERROR__SIGMA, "Sigma is out of range"},
         {ERROR__POLARIZATION, "Invalid value for polarization"},
+        {ERROR__AIRY_ARGUMENT, "Invalid kind or scaling of Airy function"},
+        {ERROR__AIRY_RANGE,
+         "Airy function argument is outside the range of its expansion data"},
+        {ERROR__WIROOT_ARGUMENT,
+         "Invalid root index, kind, or scaling of root search"},
+        {ERROR__WIROOT_CONVERGENCE,
+         "Residue series root search did not converge"},
+        {ERROR__EXECUTION,
+         "Threads could not be started, or a batch stopped unexpectedly"},
     };
     // Construct status message
     std::string msg = LIBRARY_NAME;
@@ -0,0 +1,293 @@
+/** @file RootCache.cpp
+ * Implements a process-wide cache of the roots used by the residue series.
+ */
+
+#include "LFMF.h"
+
+#include <atomic>         // for std::atomic
+#include <cmath>          // for frexp, ldexp, llround
+#include <complex>        // for std::complex
+#include <cstddef>        // for std::size_t
+#include <cstdint>        // for std::uint64_t
+#include <list>           // for std::list
+#include <memory>         // for std::shared_ptr
+#include <mutex>          // for std::mutex, std::lock_guard
+#include <unordered_map>  // for std::unordered_map
+#include <utility>        // for std::pair
+#include <vector>         // for std::vector
+
+namespace ITS {
+namespace Propagation {
+namespace LFMF {
+
+namespace {
+
+/** Number of independently locked parts of the cache */
+constexpr std::size_t ROOT_CACHE_SHARDS = 16;
+
+/** Significant bits of each component of q kept in the cache key */
+constexpr int ROOT_CACHE_KEY_BITS = 40;
+
+/** Cache key: quantized q, and the Airy function kind and scaling */
+struct RootCacheKey {
+        long long re_mantissa;
+        int re_exponent;
+        long long im_mantissa;
+        int im_exponent;
+        AiryKind kind;
+        AiryScaling scaling;
+
+        bool operator==(const RootCacheKey &other) const {
+            return re_mantissa == other.re_mantissa
+                && re_exponent == other.re_exponent
+                && im_mantissa == other.im_mantissa
+                && im_exponent == other.im_exponent && kind == other.kind
+                && scaling == other.scaling;
+        }
+};
+
+struct RootCacheKeyHash {
+        std::size_t operator()(const RootCacheKey &key) const {
+            // Combine the fields with the FNV-1a multiplier
+            std::uint64_t h = 0xCBF29CE484222325ULL;
+            const auto mix = [&h](const long long value) {
+                h = (h ^ static_cast<std::uint64_t>(value)) * 0x100000001B3ULL;
+            };
+            mix(key.re_mantissa);
+            mix(key.re_exponent);
+            mix(key.im_mantissa);
+            mix(key.im_exponent);
+            mix(static_cast<long long>(key.kind));
+            mix(static_cast<long long>(key.scaling));
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+};
+
+/** Roots of one value of q. Entries are never modified once cached. */
+struct RootCacheEntry {
+        std::vector<std::complex<double>> T;
+        std::vector<std::complex<double>> W1;
+};
+
+/** One part of the cache, with its own lock and least recently used list */
+struct RootCacheShard {
+        typedef std::pair<RootCacheKey, std::shared_ptr<const RootCacheEntry>>
+            Item;
+
+        std::mutex mutex;
+        std::list<Item> lru;  // Most recently used first
+        std::unordered_map<
+            RootCacheKey,
+            std::list<Item>::iterator,
+            RootCacheKeyHash>
+            index;
+};
+
+/** The process-wide cache */
+struct RootCache {
+        std::atomic<std::size_t> capacity{0};
+        std::atomic<unsigned long long> hits{0};
+        std::atomic<unsigned long long> misses{0};
+        std::atomic<unsigned long long> evictions{0};
+        RootCacheShard shards[ROOT_CACHE_SHARDS];
+};
+
+RootCache &GetRootCache() {
+    static RootCache cache;
+    return cache;
+}
+
+/** Round x to `ROOT_CACHE_KEY_BITS` significant bits */
+void QuantizeComponent(const double x, long long &mantissa, int &exponent) {
+    const double m = std::frexp(x, &exponent);
+    mantissa = std::llround(std::ldexp(m, ROOT_CACHE_KEY_BITS));
+    if (mantissa == 0)
+        exponent = 0;  // frexp leaves the exponent of +0 and -0 unspecified
+}
+
+RootCacheKey MakeRootCacheKey(
+    const std::complex<double> q, const AiryKind kind, const AiryScaling scaling
+) {
+    RootCacheKey key;
+    QuantizeComponent(q.real(), key.re_mantissa, key.re_exponent);
+    QuantizeComponent(q.imag(), key.im_mantissa, key.im_exponent);
+    key.kind = kind;
+    key.scaling = scaling;
+    return key;
+}
+
+/** Maximum number of entries of each shard for a total capacity */
+std::size_t ShardCapacity(const std::size_t capacity) {
+    return (capacity + ROOT_CACHE_SHARDS - 1) / ROOT_CACHE_SHARDS;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ * Set the capacity of the process-wide residue series root cache.
+ *
+ * The cache holds the roots of @f$ Wi'(t) - q*Wi(t) = 0 @f$ and the Airy
+ * function at each root, for the most recently used values of q. It is
+ * disabled by default. Values of q which agree to about 12 significant
+ * digits share an entry, which is well within the convergence tolerance of
+ * `WiRoot()`. The cache is divided into independently locked parts, so the
+ * capacity is rounded up to a multiple of the number of parts.
+ *
+ * Reducing the capacity evicts the least recently used entries.
+ *
+ * @param[in] capacity  Maximum number of values of q to hold; 0 disables the
+ *                      cache and discards its contents.
+ ******************************************************************************/
+void SetRootCacheCapacity(const std::size_t capacity) {
+    RootCache &cache = GetRootCache();
+    cache.capacity = capacity;
+
+    const std::size_t shard_capacity = ShardCapacity(capacity);
+    for (RootCacheShard &shard : cache.shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        while (shard.lru.size() > shard_capacity) {
+            shard.index.erase(shard.lru.back().first);
+            shard.lru.pop_back();
+            cache.evictions++;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Get the usage statistics of the process-wide residue series root cache.
+ *
+ * @param[out] stats  Cache statistics
+ ******************************************************************************/
+void GetRootCacheStats(RootCacheStats &stats) {
+    RootCache &cache = GetRootCache();
+    stats.capacity = cache.capacity;
+    stats.hits = cache.hits;
+    stats.misses = cache.misses;
+    stats.evictions = cache.evictions;
+    stats.size = 0;
+    for (RootCacheShard &shard : cache.shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.size += shard.lru.size();
+    }
+}
+
+/*******************************************************************************
+ * Discard the contents and reset the statistics of the process-wide residue
+ * series root cache. The capacity is unchanged.
+ ******************************************************************************/
+void ClearRootCache() {
+    RootCache &cache = GetRootCache();
+    for (RootCacheShard &shard : cache.shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.clear();
+        shard.lru.clear();
+    }
+    cache.hits = 0;
+    cache.misses = 0;
+    cache.evictions = 0;
+}
+
+/*******************************************************************************
+ * Look up the roots of a value of q in the root cache.
+ *
+ * Any number of threads may look up roots at once. The lock of a part of the
+ * cache is only held to find the entry; roots are copied out afterwards.
+ *
+ * @param[in]  q        Intermediate value -j*nu*delta
+ * @param[in]  kind     Kind of Airy function the roots were found for
+ * @param[in]  scaling  Scaling of Airy function the roots were found for
+ * @param[out] T        Cached roots, unchanged if none are cached
+ * @param[out] W1       Airy function at each cached root, unchanged if none
+ *                      are cached
+ * @return              True if roots were found in the cache
+ ******************************************************************************/
+bool LookupRootCache(
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::vector<std::complex<double>> &T,
+    std::vector<std::complex<double>> &W1
+) {
+    RootCache &cache = GetRootCache();
+    if (cache.capacity == 0)
+        return false;
+
+    const RootCacheKey key = MakeRootCacheKey(q, kind, scaling);
+    RootCacheShard &shard
+        = cache.shards[RootCacheKeyHash()(key) % ROOT_CACHE_SHARDS];
+
+    std::shared_ptr<const RootCacheEntry> entry;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            // Mark as most recently used
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            entry = it->second->second;
+        }
+    }
+
+    if (!entry) {
+        cache.misses++;
+        return false;
+    }
+    cache.hits++;
+    T = entry->T;
+    W1 = entry->W1;
+    return true;
+}
+
+/*******************************************************************************
+ * Add the roots of a value of q to the root cache.
+ *
+ * An existing entry for q is only replaced if it holds fewer roots. If the
+ * cache is full, the least recently used entry is evicted.
+ *
+ * @param[in] q        Intermediate value -j*nu*delta
+ * @param[in] kind     Kind of Airy function the roots were found for
+ * @param[in] scaling  Scaling of Airy function the roots were found for
+ * @param[in] T        Roots, in order
+ * @param[in] W1       Airy function at each root
+ ******************************************************************************/
+void StoreRootCache(
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    const std::vector<std::complex<double>> &T,
+    const std::vector<std::complex<double>> &W1
+) {
+    RootCache &cache = GetRootCache();
+    const std::size_t capacity = cache.capacity;
+    if (capacity == 0 || T.empty())
+        return;
+
+    const RootCacheKey key = MakeRootCacheKey(q, kind, scaling);
+    RootCacheShard &shard
+        = cache.shards[RootCacheKeyHash()(key) % ROOT_CACHE_SHARDS];
+
+    // Copy the roots before taking the lock
+    std::shared_ptr<RootCacheEntry> entry = std::make_shared<RootCacheEntry>();
+    entry->T = T;
+    entry->W1 = W1;
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        if (it->second->second->T.size() < T.size())
+            it->second->second = entry;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+
+    shard.lru.emplace_front(key, entry);
+    shard.index[key] = shard.lru.begin();
+    while (shard.lru.size() > ShardCapacity(capacity)) {
+        shard.index.erase(shard.lru.back().first);
+        shard.lru.pop_back();
+        cache.evictions++;
+    }
+}
+
+}  // namespace LFMF
+}  // namespace Propagation
+}  // namespace ITS
@@ -58,6 +58,36 @@ ReturnCode ValidateInput(
     return SUCCESS;
 }
 
+/*******************************************************************************
+ * Validate that the path-independent model input values are within valid
+ * ranges. Inputs are checked in the same order as by `ValidateInput()`.
+ *
+ * @param[in] f__mhz   Frequency, in MHz
+ * @param[in] N_s      Surface refractivity, in N-Units
+ * @param[in] epsilon  Relative permittivity
+ * @param[in] sigma    Conductivity, in siemens per meter
+ * @return             Return code
+ ******************************************************************************/
+ReturnCode ValidateModeSetInput(
+    const double f__mhz,
+    const double N_s,
+    const double epsilon,
+    const double sigma
+) {
+    if (f__mhz < 0.01 || f__mhz > 30)
+        return ERROR__FREQUENCY;
+
+    if (N_s < 250 || N_s > 400)
+        return ERROR__SURFACE_REFRACTIVITY;
+
+    if (epsilon < 1)
+        return ERROR__EPSILON;
+
+    if (sigma <= 0)
+        return ERROR__SIGMA;
+
+    return SUCCESS;
+}
 
 /******************************************************************************
  * Perform input Polarization validation
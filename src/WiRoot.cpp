@@ -6,13 +6,598 @@
 
 #include <cmath>      // for abs, cos, pow, sin
 #include <complex>    // for std::complex
+#include <cstdio>     // for std::fprintf
+#include <cstdlib>    // for std::abort
 #include <sstream>    // for std::ostringstream
-#include <stdexcept>  // for std::invalid_argument, std::runtime_error
+#include <stdexcept>  // for std::invalid_argument, std::range_error, std::runtime_error
+#include <string>     // for std::string, std::to_string
+#include <vector>     // for std::vector
 
 namespace ITS {
 namespace Propagation {
 namespace LFMF {
 
+namespace {
+
+/*******************************************************************************
+ * Describe a failure of `TryWiRoot()` or `TryRefineWiRoot()`.
+ *
+ * An invalid root index is not described here, since `RefineWiRoot()` has no
+ * index to report; `WiRoot()` checks for it itself.
+ *
+ * @param[in] rtn      Return code of the failed root search
+ * @param[in] kind     Kind of Airy function used
+ * @param[in] scaling  Type of scaling used
+ * @return             The message of the exception thrown by `WiRoot()`
+ ******************************************************************************/
+std::string WiRootErrorMessage(
+    const ReturnCode rtn, const AiryKind kind, const AiryScaling scaling
+) {
+    std::ostringstream oss;
+    if (rtn == ERROR__WIROOT_CONVERGENCE) {
+        oss << "WiRoot(): Root finding algorithm did not converge after 25 "
+               "iterations using Newton's method. Exiting.";
+    } else if (rtn == ERROR__AIRY_RANGE) {
+        oss << "Airy(): Center of expansion index is out of range for "
+            << "internal Airy data array. Unable to proceed.";
+    } else if ((scaling != AiryScaling::HUFFORD)
+               && (scaling != AiryScaling::WAIT)) {
+        oss << "WiRoot(): `scaling` must be one of `HUFFORD` ("
+            << static_cast<int>(AiryScaling::HUFFORD) << ") or `WAIT` ("
+            << static_cast<int>(AiryScaling::WAIT) << "), not "
+            << static_cast<int>(scaling);
+    } else {
+        oss << "WiRoot(): `kind` must be one of `WTWO` ("
+            << static_cast<int>(AiryKind::WTWO) << ") or `WONE` ("
+            << static_cast<int>(AiryKind::WONE) << "), not "
+            << static_cast<int>(kind);
+    }
+    return oss.str();
+}
+
+/*******************************************************************************
+ * Report a failure of `TryWiRoot()` or `TryRefineWiRoot()` as the exception
+ * thrown by `WiRoot()`.
+ *
+ * When the library is built without exceptions, the message is instead
+ * printed to standard error and the program is aborted.
+ *
+ * @param[in] rtn      Return code of the failed root search
+ * @param[in] message  Description of the failure
+ *
+ * @throws std::invalid_argument  If `rtn` is `ERROR__WIROOT_ARGUMENT`
+ * @throws std::range_error       If `rtn` is `ERROR__AIRY_RANGE`
+ * @throws std::runtime_error     If `rtn` is `ERROR__WIROOT_CONVERGENCE`
+ ******************************************************************************/
+[[noreturn]] void ThrowWiRootError(
+    const ReturnCode rtn, const std::string &message
+) {
+#ifdef LFMF_NO_EXCEPTIONS
+    (void)rtn;
+    std::fprintf(stderr, "%s\n", message.c_str());
+    std::abort();
+#else
+    if (rtn == ERROR__WIROOT_CONVERGENCE)
+        throw std::runtime_error(message);
+    if (rtn == ERROR__AIRY_RANGE)
+        throw std::range_error(message);
+    throw std::invalid_argument(message);
+#endif
+}
+
+/** Number of tabulated zeros of each of Ai(z) and Ai'(z) */
+constexpr int WIROOT_TABULATED_ZEROS = 200;
+
+// The first 10 zeros of Ai(z) and Ai'(z) can be found in the NIST DLMF (Digital
+// Library of Mathematical Functions), http://dlmf.nist.gov/, Table 9.9.1:
+// Zeros of Ai and Ai'. The tables below hold the first 200 of each, to 17
+// significant digits, so that `ResidueSeries()` never needs the asymptotic
+// expansions for the roots that it uses.
+
+// Zeros of the Airy function, Ai(ak) = 0
+// TINFIN(I) in GWINT.FOR
+constexpr double AI_ZEROS[WIROOT_TABULATED_ZEROS] = {
+    -2.338107410459767,
+    -4.0879494441309706,
+    -5.5205598280955511,
+    -6.786708090071759,
+    -7.9441335871208531,
+    -9.0226508533409804,
+    -10.040174341558086,
+    -11.008524303733263,
+    -11.936015563236263,
+    -12.828776752865757,
+    -13.691489035210718,
+    -14.527829951775335,
+    -15.340755135977997,
+    -16.132685156945771,
+    -16.905633997429943,
+    -17.661300105697058,
+    -18.401132599207115,
+    -19.126380474246952,
+    -19.8381298917215,
+    -20.537332907677566,
+    -21.224829943642097,
+    -21.901367595585131,
+    -22.567612917496503,
+    -23.224165001121681,
+    -23.871564455535919,
+    -24.510301236589677,
+    -25.140821166148964,
+    -25.763531400982756,
+    -26.378805052137232,
+    -26.986985111606368,
+    -27.588387809882445,
+    -28.183305502632645,
+    -28.772009165237435,
+    -29.354750558766288,
+    -29.931764119086556,
+    -30.503268611418505,
+    -31.069468585183756,
+    -31.630555658012659,
+    -32.186709652952051,
+    -32.738099609000269,
+    -33.284884681901402,
+    -33.827214949508652,
+    -34.365232133863659,
+    -34.899070250345312,
+    -35.428856192747888,
+    -35.954710261898629,
+    -36.476746644374809,
+    -36.995073846994502,
+    -37.509795092005016,
+    -38.021008677255254,
+    -38.528808305094249,
+    -39.033283383272514,
+    -39.534519300723018,
+    -40.032597680754176,
+    -40.527596613889718,
+    -41.01959087233249,
+    -41.50865210780525,
+    -41.99484903432643,
+    -42.478247597308392,
+    -42.95891113021656,
+    -43.436900499896854,
+    -43.912274241563702,
+    -44.38508868433939,
+    -44.855398068145832,
+    -45.32325465267043,
+    -45.788708819057301,
+    -46.251809164912546,
+    -46.712602593156516,
+    -47.171134395206317,
+    -47.627448328927393,
+    -48.081586691753257,
+    -48.533590389336798,
+    -48.983499000064584,
+    -49.431350835736783,
+    -49.877182998689417,
+    -50.321031435612219,
+    -50.762930988294285,
+    -51.202915441510564,
+    -51.641017568244898,
+    -52.077269172429649,
+    -52.511701129367662,
+    -52.944343423989318,
+    -53.375225187085675,
+    -53.804374729647857,
+    -54.231819575433083,
+    -54.657586491868711,
+    -55.081701519397483,
+    -55.504189999359623,
+    -55.925076600500556,
+    -56.344385344186701,
+    -56.762139628405953,
+    -57.178362250624178,
+    -57.593075429564078,
+    -58.006300825968306,
+    -58.418059562404509,
+    -58.828372242166132,
+    -59.237258967319275,
+    -59.644739355942594,
+    -60.050832558604198,
+    -60.455557274116699,
+    -60.858931764608924,
+    -61.26097386995043,
+    -61.661701021562675,
+    -62.061130255648636,
+    -62.45927822587073,
+    -62.856161215505071,
+    -63.251795149098447,
+    -63.646195603652813,
+    -64.039377819360659,
+    -64.431356709913248,
+    -64.822146872402436,
+    -65.211762596835639,
+    -65.600217875282362,
+    -65.987526410669713,
+    -66.373701625243316,
+    -66.758756668709171,
+    -67.142704426071129,
+    -67.525557525177874,
+    -67.907328343992549,
+    -68.288029017597469,
+    -68.667671444945692,
+    -69.046267295370638,
+    -69.423828014864312,
+    -69.800364832134191,
+    -70.175888764448298,
+    -70.550410623277497,
+    -70.923941019743621,
+    -71.296490369881556,
+    -71.668068899723084,
+    -72.038686650209812,
+    -72.408353481942247,
+    -72.777079079771655,
+    -73.144872957241091,
+    -73.511744460881628,
+    -73.877702774369572,
+    -74.242756922550141,
+    -74.606915775332863,
+    -74.970188051463679,
+    -75.332582322178524,
+    -75.694107014742941,
+    -76.054770415882057,
+    -76.414580675105096,
+    -76.773545807928359,
+    -77.131673699000495,
+    -77.48897210513366,
+    -77.845448658244034,
+    -78.201110868205013,
+    -78.555966125616246,
+    -78.910021704491543,
+    -79.263284764868568,
+    -79.615762355343103,
+    -79.967461415530532,
+    -80.318388778457121,
+    -80.668551172883526,
+    -81.017955225562888,
+    -81.366607463435762,
+    -81.71451431576404,
+    -82.061682116205948,
+    -82.408117104834094,
+    -82.753825430098501,
+    -83.098813150736429,
+    -83.443086237630777,
+    -83.78665057561875,
+    -84.129511965252404,
+    -84.471676124512665,
+    -84.813148690478296,
+    -85.153935220951284,
+    -85.494041196040019,
+    -85.833472019701628,
+    -86.17223302124473,
+    -86.510329456793876,
+    -86.847766510716854,
+    -87.184549297016014,
+    -87.520682860684738,
+    -87.856172179030092,
+    -88.19102216296273,
+    -88.525237658255012,
+    -88.858823446768305,
+    -89.191784247650401,
+    -89.524124718503919,
+    -89.855849456526581,
+    -90.186962999624164,
+    -90.517469827496942,
+    -90.847374362700399,
+    -91.176680971680935,
+    -91.505393965787313,
+    -91.833517602258526,
+    -92.161056085188761,
+    -92.488013566470114,
+    -92.814394146713675,
+    -93.140201876149606,
+    -93.465440755506778,
+    -93.790114736872552,
+    -94.11422772453325,
+    -94.437783575795839,
+    -94.760786101791347,
+    -95.083239068260515,
+    -95.405146196322152,
+    -95.72651116322467,
+    -96.047337603081254
+};
+
+// Zeros of the derivative of the Airy function, Ai'(akp) = 0
+// TZERO(I) in GWINT.FOR
+constexpr double AI_PRIME_ZEROS[WIROOT_TABULATED_ZEROS] = {
+    -1.0187929716474711,
+    -3.2481975821798365,
+    -4.8200992111787356,
+    -6.1633073556394865,
+    -7.3721772550477702,
+    -8.4884867340197221,
+    -9.5354490524335475,
+    -10.527660396957407,
+    -11.475056633480245,
+    -12.384788371845747,
+    -13.26221896166521,
+    -14.111501970462995,
+    -14.935937196720517,
+    -15.738201373692538,
+    -16.520503825433794,
+    -17.284695050216437,
+    -18.032344622504393,
+    -18.764798437665955,
+    -19.483221656567231,
+    -20.188631509463373,
+    -20.881922755516738,
+    -21.563887723198975,
+    -22.235232285348913,
+    -22.896588738874619,
+    -23.548526295928802,
+    -24.191559709526354,
+    -24.826156425921155,
+    -25.45274256177765,
+    -26.071707935173913,
+    -26.68341032832245,
+    -27.288179121523985,
+    -27.886318408768461,
+    -28.478109683102278,
+    -29.063814162638199,
+    -29.643674814632016,
+    -30.217918124468575,
+    -30.786755648012503,
+    -31.350385379083035,
+    -31.908992958430463,
+    -32.46275274623848,
+    -33.011828776634287,
+    -33.556375609789422,
+    -34.096539094809138,
+    -34.632457054635866,
+    -35.164259902553408,
+    -35.692071198510469,
+    -36.216008152335199,
+    -36.736182079946803,
+    -37.252698817854148,
+    -37.765659100538871,
+    -38.275158904730879,
+    -38.781289764080369,
+    -39.284139057298596,
+    -39.783790272468233,
+    -40.280323249903719,
+    -40.773814405664866,
+    -41.264336937586434,
+    -41.751961015477227,
+    -42.23675395695976,
+    -42.718780390261982,
+    -43.198102405132707,
+    -43.674779692929509,
+    -44.148869676819669,
+    -44.620427632939257,
+    -45.089506803271026,
+    -45.556158500926964,
+    -46.020432208454937,
+    -46.482375669729756,
+    -46.942034975936356,
+    -47.399454646105755,
+    -47.854677702622416,
+    -48.307745742083988,
+    -48.758699001860578,
+    -49.207576422670372,
+    -49.654415707461051,
+    -50.099253376861825,
+    -50.542124821448675,
+    -50.983064351045243,
+    -51.422105241263653,
+    -51.859279777473015,
+    -52.294619296368389,
+    -52.728154225299395,
+    -53.159914119505244,
+    -53.589927697391696,
+    -54.018222873975174,
+    -54.444826792609826,
+    -54.869765855104794,
+    -55.293065750331035,
+    -55.714751481409874,
+    -56.134847391568852,
+    -56.553377188744374,
+    -56.970363969005082,
+    -57.385830238864773,
+    -57.799797936548954,
+    -58.212288452274776,
+    -58.623322647600091,
+    -59.032920873893674,
+    -59.441102989975219,
+    -59.847888378970582,
+    -60.253295964424793,
+    -60.657344225712667,
+    -61.060051212784317,
+    -61.461434560280558,
+    -61.861511501051013,
+    -62.260298879105733,
+    -62.657813162029265,
+    -63.054070452884365,
+    -63.449086501630949,
+    -63.842876716084337,
+    -64.23545617243547,
+    -64.626839625354439,
+    -65.017041517697475,
+    -65.406075989836361,
+    -65.793956888628199,
+    -66.180697776042432,
+    -66.566311937461115,
+    -66.950812389667514,
+    -67.334211888537337,
+    -67.716522936446084,
+    -68.097757789405318,
+    -68.477928463939955,
+    -68.85704674371805,
+    -69.235124185943951,
+    -69.61217212752513,
+    -69.988201691022469,
+    -70.363223790393296,
+    -70.737249136535969,
+    -71.110288242644392,
+    -71.482351429380417,
+    -71.853448829871693,
+    -72.223590394542166,
+    -72.592785895782052,
+    -72.96104493246383,
+    -73.328376934310425,
+    -73.694791166121516,
+    -74.060296731863583,
+    -74.424902578629065,
+    -74.788617500469746,
+    -75.151450142109255,
+    -75.51340900253933,
+    -75.874502438504295,
+    -76.23473866787801,
+    -76.594125772937323,
+    -76.952671703535923,
+    -77.310384280182292,
+    -77.66727119702529,
+    -78.02334002475077,
+    -78.37859821339246,
+    -78.733053095060217,
+    -79.086711886588614,
+    -79.439581692108719,
+    -79.791669505545771,
+    -80.14298221304538,
+    -80.49352659533074,
+    -80.843309329993261,
+    -81.192336993718918,
+    -81.540616064452516,
+    -81.888152923502002,
+    -82.234953857584842,
+    -82.581025060818425,
+    -82.926372636656348,
+    -83.27100259977241,
+    -83.614920877894018,
+    -83.958133313586673,
+    -84.300645665991143,
+    -84.642463612514839,
+    -84.983592750478893,
+    -85.324038598722337,
+    -85.663806599164761,
+    -86.002902118328764,
+    -86.341330448823462,
+    -86.67909681079027,
+    -87.016206353312138,
+    -87.352664155787364,
+    -87.688475229269076,
+    -88.023644517771439,
+    -88.358176899543589,
+    -88.692077188312276,
+    -89.025350134494155,
+    -89.358000426378628,
+    -89.690032691282126,
+    -90.021451496674657,
+    -90.352261351279448,
+    -90.682466706146464,
+    -91.012071955700564,
+    -91.341081438765026,
+    -91.669499439561149,
+    -91.997330188684624,
+    -92.324577864059324,
+    -92.651246591869159,
+    -92.977340447468609,
+    -93.302863456272545,
+    -93.627819594625892,
+    -93.952212790653718,
+    -94.276046925092268,
+    -94.599325832101481,
+    -94.922053300059487,
+    -95.244233072339571,
+    -95.565868848070091,
+    -95.886964282877792
+};
+
+/*******************************************************************************
+ * Phase which turns the real zeros of Ai(z) and Ai'(z) into the roots of
+ * @f$ Wi'(ti) - q*Wi(ti) = 0 @f$ for @f$ q @f$ infinite and zero.
+ *
+ * @param[in] kind     Kind of Airy function used, either `WONE` or `WTWO`
+ * @param[in] scaling  Type of scaling used, either `HUFFORD` or `WAIT`
+ * @return             Airy root phase
+ ******************************************************************************/
+std::complex<double> AiryRootPhase(
+    const AiryKind kind, const AiryScaling scaling
+) noexcept {
+    // This is the similar to the initial scaling that is done in Airy()
+    // Note that W1 Wait = Wi(2) Hufford and W2 Wait = Wi(1) Hufford
+    // So the following inequalities keep this all straight
+    if ((kind == AiryKind::WONE && scaling == AiryScaling::HUFFORD)
+        || (kind == AiryKind::WTWO && scaling == AiryScaling::WAIT)) {
+        // Wi(1)(Z) in Eqn 38 Hufford NTIA Report 87-219 or Wait W2
+        return std::complex<double>(
+            std::cos(-2.0 * PI / 3.0), std::sin(-2.0 * PI / 3.0)
+        );
+    }
+    // Wi(2)(Z) in Eqn 38 Hufford NTIA Report 87-219 or Wait W1
+    return std::complex<double>(
+        std::cos(2.0 * PI / 3.0), std::sin(2.0 * PI / 3.0)
+    );
+}
+
+/*******************************************************************************
+ * Starting point of the search for the @f$ i @f$-th root of
+ * @f$ Wi'(ti) - q*Wi(ti) = 0 @f$.
+ *
+ * As @f$ q @f$ goes from zero to infinity, the root moves from a rotated zero
+ * @f$ t_0 @f$ of Ai'(z) to one of Ai(z). Since @f$ dt/dq = 1/(t - q^2) @f$,
+ * small @f$ q @f$ gives
+ * @f$ t = t_0 + q/t_0 - q^2/(2 t_0^3) + q^3 (1/(3 t_0^2) + 1/(2 t_0^5)) @f$,
+ * and since @f$ dt/dp = 1/(1 - t p^2) @f$ for @f$ p = 1/q @f$, large
+ * @f$ q @f$ gives @f$ t = t_0 + p + t_0 p^3/3 + p^4/4 @f$.
+ *
+ * @param[in] i   The @f$ i @f$-th root, starting with 1
+ * @param[in] q   Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in] ph  Airy root phase from `AiryRootPhase()`
+ * @return        Starting point of the root search
+ ******************************************************************************/
+std::complex<double> WiRootStart(
+    const int i, const std::complex<double> q, const std::complex<double> ph
+) noexcept {
+    double t, tt;  // Temp
+
+    // Note: The zeros of the Airy functions i[ak'] and Ak'[ak], ak' and ak, are on the negative real axis.
+    // This is why 4*i+3 and 4*i+1 are used here instead of 4*k-3 and 4*k-1 which are
+    // used in 9.9.8 and 9.9.6 in NIST DLMF. We are finding the ith negative root here.
+    if (std::pow(std::abs(q), 3.0) <= 4 * (i - 1) + 3) {
+        // Small Z, use ak' as the first guess (Ak(ak') = 0)
+        if (i <= WIROOT_TABULATED_ZEROS) {
+            // The desired root is in the table above
+            tt = AI_PRIME_ZEROS[i - 1];
+        } else {
+            // The desired root is a higher order than those given in the table above
+            // so we will approximate it from the first three terms of NIST DLMF 9.9.1.9
+            // First find the argument (9.9.8) used in 9.9.1.9 for the ith negative root of Ai'(ak).
+            t = (3.0 / 8.0) * PI * (4.0 * (i - 1) + 1);
+            tt = -1.0 * std::pow(t, 2.0 / 3.0)
+               * (1.0 - ((7.0 / 48.0) * std::pow(t, -2.0))
+                  + ((35.0 / 288.0) * std::pow(t, -4.0)));
+        };
+        // Make the real Airy root complex; it is the solution for q = 0
+        const std::complex<double> t_0 = tt * ph;
+        const std::complex<double> t_0_2 = t_0 * t_0;
+        const std::complex<double> t_0_3 = t_0_2 * t_0;
+        return t_0 + q / t_0 - q * q / (2.0 * t_0_3)
+             + q * q * q * (1.0 / (3.0 * t_0_2) + 1.0 / (2.0 * t_0_3 * t_0_2));
+    }
+
+    // Large q, use ak as the first guess (Ai'(ak) = 0)
+    if (i <= WIROOT_TABULATED_ZEROS) {
+        // The desired root is in the table above
+        tt = AI_ZEROS[i - 1];
+    } else {
+        // The desired root must be approximated from the first three terms of NIST DLMF 9.9.1.8
+        // First find the argument (9.9.6) used in 9.9.1.8 for the ith negative root of Ai(ak).
+        t = (3.0 / 8.0) * PI * (4.0 * (i - 1) + 3.0);
+        tt = -1.0 * std::pow(t, 2.0 / 3.0)
+           * (1.0 + ((5.0 / 48.0) * std::pow(t, -2.0))
+              - ((5.0 / 36.0) * std::pow(t, -4.0)));
+    };
+    // The rotated root is the solution for q = infinity
+    const std::complex<double> t_0 = tt * ph;
+    const std::complex<double> p = 1.0 / q;
+    const std::complex<double> p_2 = p * p;
+    return t_0 + p + t_0 * p_2 * p / 3.0 + p_2 * p_2 / 4.0;
+}
+
+}  // namespace
+
 /*******************************************************************************
  * Finds the roots to the equation @f$ Wi'(ti) - q*Wi(ti) = 0 @f$
  *
@@ -40,6 +625,9 @@ namespace LFMF {
  * @throws std::invalid_argument  If the values provided for `i`, `kind`, or
  *                                `scaling` are not valid for this function.
  * @throws std::runtime_error     If the root finding algorithm fails to converge.
+ *                                In a library built without exceptions, these
+ *                                failures abort the program instead;
+ *                                `TryWiRoot()` reports them by return code.
  * 
  * **References**
  *     - "Airy Functions of the third kind" are found in equation 38 of [NTIA
@@ -59,165 +647,196 @@ std::complex<double> WiRoot(
     const AiryKind kind,
     const AiryScaling scaling
 ) {
-    std::complex<double> ph;  // Airy root phase
-    std::complex<double> ti;  // ith cplx root of Wi'(2)(ti) - q*Wi(2)(ti) = 0
-    std::complex<double> tw;  // Return variable
+    int iterations;  // Not reported by this overload
+    return WiRoot(i, DWi, q, Wi, kind, scaling, iterations);
+}
 
-    std::complex<double> A;  // Temp
-    double t, tt;            // Temp
-    double eps;              // Temp
-    int cnt;                 // Temp
-    AiryKind dkind;          // Temp
-
-    // From the NIST DLMF (Digital Library of Mathematical Functions)
-    // http://dlmf.nist.gov/
-    // The first 10 roots of Ai(Z) and Ai'(Z) can be found in: Table 9.9.1: Zeros of Ai and Ai.
-    // Note: That ak is the root of Ai(ak) while akp (ak') is the root of Ai'(akp)
-
-    // Root of the Airy function, Ai(ak)
-    // TZERO(I) in GWINT.FOR
-    constexpr double akp[11]
-        = {-1.0187929716,
-           -3.2481975822,
-           -4.8200992112,
-           -6.1633073556,
-           -7.3721772550,
-           -8.4884867340,
-           -9.5354490524,
-           -10.5276603970,
-           -11.4750666335,
-           -12.3847883718,
-           -13.2636395229};
-
-    // Root of the derivative of Airy function, Ai'(akp)
-    // TINFIN(I) in GWINT.FOR
-    constexpr double ak[11]
-        = {-2.3381074105,
-           -4.0879494441,
-           -5.5205698281,
-           -6.7867080901,
-           -7.9441335871,
-           -9.0226508533,
-           -10.0401743416,
-           -11.0085243037,
-           -11.9360255632,
-           -12.8287867529,
-           -13.6914890352};
+/*******************************************************************************
+ * Finds the roots to the equation @f$ Wi'(ti) - q*Wi(ti) = 0 @f$, and reports
+ * the number of iterations used.
+ *
+ * See the overload without `iterations` for a full description. By default
+ * the root is refined by Newton's method, as by that overload. Halley's method
+ * may be selected instead: since @f$ Wi''(t) = t Wi(t) @f$, the second
+ * derivative of the equation comes from the same Airy functions as the first,
+ * so each iteration costs the same but convergence is of third order.
+ *
+ * @param[in]  i           The @f$ i @f$-th complex root of
+ *                         @f$ Wi'^{(2)}(ti) - q*Wi^{(2)}(ti) @f$, starting with 1.
+ * @param[in]  q           Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in]  kind        Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in]  scaling     Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @param[out] DWi         Derivative of "Airy function of the third kind"
+ *                         @f$ Wi'^{(2)}(ti) @f$
+ * @param[out] Wi          "Airy function of the third kind" @f$ Wi^{(2)}(ti) @f$
+ * @param[out] iterations  Number of iterations used
+ * @param[in]  iteration   Iteration used to refine the root
+ * @return                 The @f$ i @f$-th complex root of the "Airy function
+ *                         of the third kind"
+ * 
+ * @throws std::invalid_argument  If the values provided for `i`, `kind`, or
+ *                                `scaling` are not valid for this function.
+ * @throws std::runtime_error     If the root finding algorithm fails to converge.
+ ******************************************************************************/
+std::complex<double> WiRoot(
+    const int i,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration
+) {
+    std::complex<double> ti;
+    const ReturnCode rtn
+        = TryWiRoot(i, DWi, q, Wi, kind, scaling, ti, iterations, iteration);
+    if (rtn == ERROR__WIROOT_ARGUMENT && i <= 0)
+        ThrowWiRootError(
+            rtn, "WiRoot(): The root `i` must be > 0, not " + std::to_string(i)
+        );
+    if (rtn != SUCCESS)
+        ThrowWiRootError(rtn, WiRootErrorMessage(rtn, kind, scaling));
+    return ti;
+}
 
+/*******************************************************************************
+ * Finds the roots to the equation @f$ Wi'(ti) - q*Wi(ti) = 0 @f$, reporting
+ * failures by return code instead of by exception.
+ *
+ * Results are identical to those of `WiRoot()`, which describes the roots.
+ *
+ * @param[in]  i           The @f$ i @f$-th complex root of
+ *                         @f$ Wi'^{(2)}(ti) - q*Wi^{(2)}(ti) @f$, starting with 1.
+ * @param[in]  q           Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in]  kind        Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in]  scaling     Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @param[out] DWi         Derivative of "Airy function of the third kind"
+ *                         @f$ Wi'^{(2)}(ti) @f$
+ * @param[out] Wi          "Airy function of the third kind" @f$ Wi^{(2)}(ti) @f$
+ * @param[out] ti          The @f$ i @f$-th complex root of the "Airy function
+ *                         of the third kind"
+ * @param[out] iterations  Number of iterations used
+ * @param[in]  iteration   Iteration used to refine the root
+ * @return                 `SUCCESS`; `ERROR__WIROOT_ARGUMENT` if the values
+ *                         provided for `i`, `kind`, or `scaling` are not valid;
+ *                         or a failure of `TryRefineWiRoot()`
+ *
+ * @see ITS::Propagation::LFMF::WiRoot
+ ******************************************************************************/
+ReturnCode TryWiRoot(
+    const int i,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> &ti,
+    int &iterations,
+    const WiRootIteration iteration
+) noexcept {
     // Verify that the input data is correct
     // Make sure that the desired root is greater than or equal to one
-    if (i <= 0) {
-        // Input `i` must be > 0; throw an exception
-        std::ostringstream oss;
-        oss << "WiRoot(): The root `i` must be > 0, not " << i;
-        throw std::invalid_argument(oss.str());
-    };
-
-    if ((scaling != AiryScaling::HUFFORD) && (scaling != AiryScaling::WAIT)) {
-        // Input `scaling` is invalid; throw an exception
-        std::ostringstream oss;
-        oss << "WiRoot(): `scaling` must be one of `HUFFORD` ("
-            << static_cast<int>(AiryScaling::HUFFORD) << ") or `WAIT` ("
-            << static_cast<int>(AiryScaling::WAIT) << "), not "
-            << static_cast<int>(scaling);
-        throw std::invalid_argument(oss.str());
-    };
-
-    if ((kind != AiryKind::WTWO) && (kind != AiryKind::WONE)) {
-        // Input `kind` is invalid; throw an exception
-        std::ostringstream oss;
-        oss << "WiRoot(): `kind` must be one of `WTWO` ("
-            << static_cast<int>(AiryKind::WTWO) << ") or `WONE` ("
-            << static_cast<int>(AiryKind::WONE) << "), not "
-            << static_cast<int>(kind);
-        throw std::invalid_argument(oss.str());
-    };
+    iterations = 0;
+    if (i <= 0)
+        return ERROR__WIROOT_ARGUMENT;
+    if ((scaling != AiryScaling::HUFFORD) && (scaling != AiryScaling::WAIT))
+        return ERROR__WIROOT_ARGUMENT;
+    if ((kind != AiryKind::WTWO) && (kind != AiryKind::WONE))
+        return ERROR__WIROOT_ARGUMENT;
     // Input parameters verified
 
     // Initialize the Wi and Wi'(z)functions
     DWi = std::complex<double>(0.0, 0.0);  // Wi'(z)
     Wi = std::complex<double>(0.0, 0.0);   // Wi(z)
 
-    // This routine starts with a real root of the Airy function to find the complex root
-    // The real root has to be turned into a complex number.
+    // This routine starts with a real root of the Airy function to find the
+    // complex root. The real root is turned into a complex number, then
+    // corrected for q.
+    ti = WiRootStart(i, q, AiryRootPhase(kind, scaling));
 
-    // ph is a factor that is used to find the root of the Wi function
-    // Determine what scaling the user wants and which Wi function is used to set ph and
-    // the dkind flag. This will allow that the real root that starts this process can be
-    // scaled appropriately.
-    // This is the similar to the initial scaling that is done in Airy()
-    // Note that W1 Wait = Wi(2) Hufford and W2 Wait = Wi(1) Hufford
-    // So the following inequalities keep this all straight
-    if ((kind == AiryKind::WONE && scaling == AiryScaling::HUFFORD)
-        || (kind == AiryKind::WTWO && scaling == AiryScaling::WAIT)) {
-        // Wi(1)(Z) in Eqn 38 Hufford NTIA Report 87-219 or Wait W2
-        ph = std::complex<double>(
-            std::cos(-2.0 * PI / 3.0), std::sin(-2.0 * PI / 3.0)
-        );
-        // Set the dkind flag
-        if (scaling == AiryScaling::WAIT) {
-            dkind = AiryKind::DWTWO;
-        } else {
-            dkind = AiryKind::DWONE;
-        };
-    } else if ((kind == AiryKind::WTWO && scaling == AiryScaling::HUFFORD)
-               || (kind == AiryKind::WONE && scaling == AiryScaling::WAIT)) {
-        // Wi(2)(Z) in Eqn 38 Hufford NTIA Report 87-219 or Wait W1
-        ph = std::complex<double>(
-            std::cos(2.0 * PI / 3.0), std::sin(2.0 * PI / 3.0)
-        );
-        if (scaling == AiryScaling::WAIT) {
-            dkind = AiryKind::DWONE;
-        } else {
-            dkind = AiryKind::DWTWO;
-        };
-    } else {
-        dkind = AiryKind::DWONE;  // Not used, initialized for compile warning
-    }
+    return TryRefineWiRoot(
+        ti, DWi, q, Wi, kind, scaling, iterations, iteration
+    );
+}
 
-    // Note: The zeros of the Airy functions i[ak'] and Ak'[ak], ak' and ak, are on the negative real axis.
-    // This is why 4*i+3 and 4*i+1 are used here instead of 4*k-3 and 4*k-1 which are
-    // used in 9.9.8 and 9.9.6 in NIST DLMF. We are finding the ith negative root here.
-    if (std::pow(std::abs(q), 3.0) <= 4 * (i - 1) + 3) {
-        // Small Z, use ak' as the first guess (Ak(ak') = 0)
-        if (i <= 10) {
-            // The desired root is less than 10 so it is in the array above
-            tt = akp[i - 1];
-        } else {
-            // The desired root is a higher order than those given in the ak array above
-            // so we will approximate it from the first three terms of NIST DLMF 9.9.1.9
-            // First find the argument (9.9.8) used in 9.9.1.9 for the ith negative root of Ai'(ak).
-            t = (3.0 / 8.0) * PI * (4.0 * (i - 1) + 1);
-            tt = -1.0 * std::pow(t, 2.0 / 3.0)
-               * (1.0 - ((7.0 / 48.0) * std::pow(t, -2.0))
-                  + ((35.0 / 288.0) * std::pow(t, -4.0)));
-        };
-        // Make the real Airy root complex
-        ti = tt * ph;
-        // t is now the solution for q = 0, The next step is the first Newton iteration
-        ti = ti + q / ti;
-    } else {
-        // Large q, use ak as the first guess (Ai'(ak) = 0)
-        if (i <= 10) {
-            // The desired root is less than 10 so it is in the array above
-            tt = ak[i - 1];
-        } else {
-            // The desired root must be approximated from the first three terms of NIST DLMF 9.9.1.8
-            // First find the argument (9.9.6) used in 9.9.1.8 for the ith negative root of Ai(ak).
-            t = (3.0 / 8.0) * PI * (4.0 * (i - 1) + 3.0);
-            tt = -1.0 * std::pow(t, 2.0 / 3.0)
-               * (1.0 + ((5.0 / 48.0) * std::pow(t, -2.0))
-                  - ((5.0 / 36.0) * std::pow(t, -4.0)));
-        };
-        ti = tt * ph;
-        // t is now the solution for Z = infinity. Next step the first newton iteration
-        ti = ti + 1.0 / q;
-    };
+/*******************************************************************************
+ * Refines an approximate root of @f$ Wi'(ti) - q*Wi(ti) = 0 @f$ by Newton's
+ * method, or by Halley's method if selected.
+ *
+ * This is the iteration used by `WiRoot()` once it has found a starting point.
+ * It is also used to start from a root found for a nearby value of `q`.
+ * Inputs are assumed to have already been validated by `WiRoot()`.
+ *
+ * @param[in]  ti          Starting point of the iteration
+ * @param[in]  q           Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in]  kind        Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in]  scaling     Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @param[out] DWi         Derivative of "Airy function of the third kind"
+ *                         @f$ Wi'^{(2)}(ti) @f$
+ * @param[out] Wi          "Airy function of the third kind" @f$ Wi^{(2)}(ti) @f$
+ * @param[out] iterations  Number of iterations used
+ * @param[in]  iteration   Iteration used to refine the root
+ * @return                 The refined complex root
+ * 
+ * @throws std::runtime_error  If the iteration fails to converge.
+ ******************************************************************************/
+std::complex<double> RefineWiRoot(
+    std::complex<double> ti,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration
+) {
+    const ReturnCode rtn = TryRefineWiRoot(
+        ti, DWi, q, Wi, kind, scaling, iterations, iteration
+    );
+    if (rtn != SUCCESS)
+        ThrowWiRootError(rtn, WiRootErrorMessage(rtn, kind, scaling));
+    return ti;
+}
+
+/*******************************************************************************
+ * Refines an approximate root of @f$ Wi'(ti) - q*Wi(ti) = 0 @f$ by Newton's
+ * or Halley's method, reporting failures by return code instead of by
+ * exception.
+ *
+ * Inputs are assumed to have already been validated by `TryWiRoot()`.
+ *
+ * @param[in,out] ti          Starting point of the iteration; on return, the
+ *                            refined complex root, or the last iterate if the
+ *                            iteration failed
+ * @param[in]     q           Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in]     kind        Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in]     scaling     Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @param[out]    DWi         Derivative of "Airy function of the third kind"
+ *                            @f$ Wi'^{(2)}(ti) @f$
+ * @param[out]    Wi          "Airy function of the third kind" @f$ Wi^{(2)}(ti) @f$
+ * @param[out]    iterations  Number of iterations used
+ * @param[in]     iteration   Iteration used to refine the root
+ * @return                    `SUCCESS`; `ERROR__WIROOT_CONVERGENCE` if the
+ *                            iteration fails to converge; or a failure of
+ *                            `TryAiryPair()` at an iterate
+ ******************************************************************************/
+ReturnCode TryRefineWiRoot(
+    std::complex<double> &ti,
+    std::complex<double> &DWi,
+    const std::complex<double> q,
+    std::complex<double> &Wi,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    int &iterations,
+    const WiRootIteration iteration
+) noexcept {
+    std::complex<double> A;  // Temp
 
-    cnt = 0;       // Set the iteration counter
-    eps = 0.5e-6;  // Set the error desired for the iteration
+    int cnt = 0;                    // Set the iteration counter
+    constexpr double eps = 0.5e-6;  // Set the error desired for the iteration
 
-    // Now iterate by Newton's method
+    // Now iterate by Newton's method, or Halley's method if selected
 
     //////////////////////////////////////////////////////////////////////
     // Note: We can use the following from
@@ -225,14 +844,28 @@ std::complex<double> WiRoot(
     // Radio Science Vol. 69D, No. 11 , November 1965
     // Eqn (14) E(t)  = W2'(t) - q W2(t)
     // Eqn (39) E'(t) = t W2(t) - q W2'(t)
+    // and, from the Airy equation W2''(t) = t W2(t),
+    //          E''(t) = W2(t) + t W2'(t) - q t W2(t)
     //////////////////////////////////////////////////////////////////////
     do {
         // f(q) = Wi'(ti) - q*Wi(ti)
-        Wi = Airy(ti, kind, scaling);
         // f'(q) = tw*Wi(ti) - q*Wi'(ti);
-        DWi = Airy(ti, dkind, scaling);
-        // The Newton correction factor for iteration f(q)/f'(q)
-        A = (DWi - q * (Wi)) / (ti * (Wi)-q * (DWi));
+        // Wi(ti) and Wi'(ti) both come from one Airy evaluation
+        const ReturnCode rtn = TryAiryPair(ti, kind, scaling, Wi, DWi);
+        if (rtn != SUCCESS) {
+            iterations = cnt;
+            return rtn;
+        }
+        if (iteration == WiRootIteration::HALLEY) {
+            // The Halley correction factor 2 f f' / (2 f'^2 - f f'')
+            const std::complex<double> f = DWi - q * Wi;
+            const std::complex<double> df = ti * Wi - q * DWi;
+            const std::complex<double> d2f = Wi + ti * DWi - q * ti * Wi;
+            A = 2.0 * f * df / (2.0 * df * df - f * d2f);
+        } else {
+            // The Newton correction factor for iteration f(q)/f'(q)
+            A = (DWi - q * (Wi)) / (ti * (Wi)-q * (DWi));
+        }
         ti = ti - A;  // New root guess ti
         cnt++;        // Increment the counter
 
@@ -240,19 +873,206 @@ std::complex<double> WiRoot(
              && ((std::abs((A / ti).real()) + (std::abs((A / ti).imag())) > eps)
              ));
 
+    iterations = cnt;
+
     // Check to see if there if the loop converged on an answer
     // The cnt that fails is an arbitrary number; most converge in ~5 tries
-    if (cnt == 26) {
-        std::ostringstream oss;
-        oss << "WiRoot(): Root finding algorithm did not converge after 25 "
-               "iterations using Newton's method. Exiting.";
-        throw std::runtime_error(oss.str());
-    } else {
-        // Converged!
-        tw = ti;
-    };
+    if (cnt == 26)
+        return ERROR__WIROOT_CONVERGENCE;
+
+    // Converged!
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * Predicts the @f$ i @f$-th root of @f$ Wi'(ti) - q*Wi(ti) = 0 @f$ from the
+ * two roots before it, as a starting point for `TryRefineWiRoot()`.
+ *
+ * The difference between each root and the starting point that `WiRoot()`
+ * would use for it varies slowly with @f$ i @f$, so it is extrapolated
+ * linearly from roots @f$ i-1 @f$ and @f$ i-2 @f$ and added to the starting
+ * point of root @f$ i @f$. This is usually close enough that a single
+ * iteration converges. Callers should check that the refined root is nearer
+ * to the prediction than to its neighbours before accepting it.
+ *
+ * Inputs are assumed to have already been validated by `WiRoot()`.
+ *
+ * @param[in] i        The @f$ i @f$-th root, starting with 3
+ * @param[in] t_1      The @f$ (i-1) @f$-th root
+ * @param[in] t_2      The @f$ (i-2) @f$-th root
+ * @param[in] q        Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in] kind     Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in] scaling  Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @return             Predicted @f$ i @f$-th root
+ ******************************************************************************/
+std::complex<double> ExtrapolateWiRoot(
+    const int i,
+    const std::complex<double> t_1,
+    const std::complex<double> t_2,
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling
+) noexcept {
+    const std::complex<double> ph = AiryRootPhase(kind, scaling);
+    return WiRootStart(i, q, ph) + 2.0 * (t_1 - WiRootStart(i - 1, q, ph))
+         - (t_2 - WiRootStart(i - 2, q, ph));
+}
+
+/*******************************************************************************
+ * Finds a block of consecutive roots of @f$ Wi'(ti) - q*Wi(ti) = 0 @f$ at
+ * once, by an iteration of the Aberth-Ehrlich kind, reporting failures by
+ * return code.
+ *
+ * Each root @f$ k @f$ starts from the point @f$ s_k @f$ that `WiRoot()` would
+ * use, or, if the two roots before the block are given, from that point
+ * moved as by `ExtrapolateWiRoot()`. The equation has infinitely many roots,
+ * and the starting points already place each root among its neighbours, so
+ * only the movement of the other roots of the block is deflated: each
+ * iteration moves root @f$ k @f$ by @f$ w_k / (1 - w_k S_k) @f$, where
+ * @f$ w_k @f$ is the Newton correction of `TryRefineWiRoot()` and
+ * @f$ S_k = \sum_{j \ne k} 1/(t_k - t_j) - 1/(t_k - s_j) @f$.
+ *
+ * A root stops, taking its Newton correction @f$ w_k @f$, once that
+ * correction meets the test of `TryRefineWiRoot()`, or once the error it
+ * leaves, estimated from the second derivative @f$ Wi''(t) = t Wi(t) @f$, is
+ * below a hundredth of that tolerance. Roots then need no further evaluation of the Airy
+ * functions just to confirm that they have converged, and they agree with
+ * those of `WiRoot()` to within its tolerance. The tests use @f$ w_k @f$
+ * rather than the deflated correction, which also vanishes where a root
+ * meets the starting point of another. A root which has not stopped after
+ * 25 iterations, such as one held between two close neighbours, is found
+ * alone from its starting point by `TryRefineWiRoot()`, as by `WiRoot()`.
+ *
+ * Within an iteration, the work of each root depends only on the iterates of
+ * the iteration before, so the roots of a block may be refined in any order,
+ * or in parallel.
+ *
+ * @param[in]  first       The first root of the block, starting with 1
+ * @param[in]  n           Number of roots in the block
+ * @param[in]  q           Intermediate value: @f$ -j \nu \delta @f$
+ * @param[in]  kind        Kind of Airy function to use, either `WONE` or `WTWO`
+ * @param[in]  scaling     Type of scaling to use, either `HUFFORD` or `WAIT`
+ * @param[out] ti          Roots `first` to `first + n - 1`
+ * @param[out] iterations  Total iterations used by the roots of the block; each
+ *                         is one evaluation of `TryAiryPair()`
+ * @param[in]  t_prev      If not null, roots `first - 2` and `first - 1`
+ * @return                 `SUCCESS`; `ERROR__WIROOT_ARGUMENT` if the values
+ *                         provided for `first`, `kind`, or `scaling` are not
+ *                         valid; `ERROR__WIROOT_CONVERGENCE` if a root fails
+ *                         to converge; or a failure of `TryAiryPair()`
+ *
+ * @see ITS::Propagation::LFMF::WiRoot
+ ******************************************************************************/
+ReturnCode TryWiRootBlock(
+    const int first,
+    const std::size_t n,
+    const std::complex<double> q,
+    const AiryKind kind,
+    const AiryScaling scaling,
+    std::complex<double> *ti,
+    long &iterations,
+    const std::complex<double> *t_prev
+) noexcept {
+    constexpr double eps = 0.5e-6;  // Set the error desired for the iteration
+    constexpr double err_tol = 0.01 * eps;  // Estimated error when stopping
+
+    iterations = 0;
+    if (first <= 0)
+        return ERROR__WIROOT_ARGUMENT;
+    if ((scaling != AiryScaling::HUFFORD) && (scaling != AiryScaling::WAIT))
+        return ERROR__WIROOT_ARGUMENT;
+    if ((kind != AiryKind::WTWO) && (kind != AiryKind::WONE))
+        return ERROR__WIROOT_ARGUMENT;
+
+    const std::complex<double> ph = AiryRootPhase(kind, scaling);
+
+    // Offset of the roots before the block from their starting points
+    std::complex<double> r_1(0.0, 0.0), dr(0.0, 0.0);
+    if (t_prev != nullptr && first > 2) {
+        r_1 = t_prev[1] - WiRootStart(first - 1, q, ph);
+        dr = r_1 - (t_prev[0] - WiRootStart(first - 2, q, ph));
+    }
+
+    std::vector<std::complex<double>> s(n);  // Starting point of each root
+    std::vector<std::complex<double>> A(n);  // Correction of each root
+    std::vector<std::complex<double>> w(n);  // Newton correction of each root
+    std::vector<double> err(n);              // Error left by each correction
+    std::vector<char> active(n, 1);          // 1 while a root is iterating
+    std::size_t n_active = n;
+    for (std::size_t k = 0; k < n; k++) {
+        s[k] = WiRootStart(first + static_cast<int>(k), q, ph) + r_1
+             + double(k + 1) * dr;
+        ti[k] = s[k];
+    }
+
+    int cnt = 0;  // Set the iteration counter
+    while (n_active > 0 && cnt++ <= 25) {
+        // Find the correction of each root from the last iterates
+        for (std::size_t k = 0; k < n; k++) {
+            if (!active[k])
+                continue;
+            std::complex<double> Wi, DWi;
+            const ReturnCode rtn = TryAiryPair(ti[k], kind, scaling, Wi, DWi);
+            if (rtn != SUCCESS)
+                return rtn;
+            iterations++;
+
+            // f(q) = Wi'(ti) - q*Wi(ti) and its derivatives, as in
+            // TryRefineWiRoot()
+            const std::complex<double> f = DWi - q * Wi;
+            const std::complex<double> df = ti[k] * Wi - q * DWi;
+            const std::complex<double> d2f = Wi + ti[k] * DWi - q * ti[k] * Wi;
+
+            // Deflate the movement of the other roots of the block
+            std::complex<double> S(0.0, 0.0);
+            for (std::size_t j = 0; j < n; j++) {
+                if (j != k)
+                    S += 1.0 / (ti[k] - ti[j]) - 1.0 / (ti[k] - s[j]);
+            }
+            w[k] = f / df;
+            A[k] = w[k] / (1.0 - w[k] * S);
+
+            // The Newton correction leaves an error of about |f''/(2f')| |w|^2
+            err[k] = std::abs(d2f / (2.0 * df)) * std::norm(w[k])
+                   / std::abs(ti[k]);
+        }
+
+        for (std::size_t k = 0; k < n; k++) {
+            if (!active[k])
+                continue;
+            // A root which stops takes its last Newton correction
+            if ((std::abs((w[k] / ti[k]).real())
+                 + std::abs((w[k] / ti[k]).imag()))
+                    <= eps
+                || err[k] <= err_tol) {
+                ti[k] -= w[k];
+                active[k] = 0;
+                n_active--;
+            } else {
+                ti[k] -= A[k];
+            }
+        }
+    }
+
+    // Roots which did not converge together are found alone
+    for (std::size_t k = 0; k < n && n_active > 0; k++) {
+        if (!active[k])
+            continue;
+        std::complex<double> Wi, DWi;
+        int refine_iterations;
+        ti[k] = s[k];
+        const ReturnCode rtn = TryRefineWiRoot(
+            ti[k], DWi, q, Wi, kind, scaling, refine_iterations
+        );
+        iterations += refine_iterations;
+        if (rtn != SUCCESS)
+            return rtn;
+        active[k] = 0;
+        n_active--;
+    }
 
-    return tw;
+    // Converged!
+    return SUCCESS;
 }
 
 }  // namespace LFMF
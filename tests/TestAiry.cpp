@@ -4,11 +4,32 @@
 
 #include "TestUtils.h"
 
-#include <cmath>      // for cos, sin, sqrt
-#include <stdexcept>  // for std::invalid_argument
+#include <cmath>      // for abs, cos, floor, isfinite, pow, sin, sqrt
+#include <cstddef>    // for std::size_t
+#include <cstdlib>    // for std::free, std::malloc
+#include <new>        // for std::bad_alloc
+#include <stdexcept>  // for std::invalid_argument, std::range_error
+#include <vector>     // for std::vector
 
 constexpr double AIRY_TOL = 1.0e-4;
 
+/** Number of allocations made by the current thread */
+thread_local std::size_t allocations = 0;
+
+// Count the allocations of the test program, and of the library when it
+// shares the allocator of the program
+void *operator new(std::size_t size) {
+    allocations++;
+    void *p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
 /** Test fixture provides valid inputs for Airy */
 class TestAiry: public ::testing::Test {
     protected:
@@ -214,6 +235,7 @@ TEST_F(TestAiry, TestThirdKindDefinition) {
     EXPECT_NEAR(wi.imag(), expected.imag(), 1.0e-5);
 }
 
+#ifndef LFMF_NO_EXCEPTIONS
 /** Invalid `scaling` input throws an exception */
 TEST_F(TestAiry, InvalidScaling) {
     scaling = static_cast<AiryScaling>(-1);
@@ -230,3 +252,426 @@ TEST_F(TestAiry, InvalidScaling) {
     kind = AiryKind::DWTWO;
     EXPECT_THROW(Airy(Z, kind, scaling), std::invalid_argument);
 }
+
+/** An argument beyond the center of expansion data throws an exception */
+TEST_F(TestAiry, OutOfRange) {
+    Z = {7.0, 6.0};
+    EXPECT_THROW(Airy(Z, kind, scaling), std::range_error);
+}
+#endif
+
+/** The status-returning variant matches `Airy()` */
+TEST_F(TestAiry, TryAiryMatchesAiry) {
+    const std::complex<double> args[] = {{8.0, 8.0}, {1.0, -2.0}, {-3.0, 0.5}};
+    for (const std::complex<double> &z : args) {
+        for (const AiryKind k : {AiryKind::AIRY, AiryKind::BAIRYD}) {
+            std::complex<double> result;
+            EXPECT_EQ(TryAiry(z, k, AiryScaling::NONE, result), SUCCESS);
+            EXPECT_EQ(result, Airy(z, k, AiryScaling::NONE)) << "Z = " << z;
+        }
+        std::complex<double> result;
+        EXPECT_EQ(TryAiry(z, AiryKind::DWONE, AiryScaling::WAIT, result), SUCCESS);
+        EXPECT_EQ(result, Airy(z, AiryKind::DWONE, AiryScaling::WAIT));
+    }
+}
+
+/** The status-returning variant reports failures by return code */
+TEST_F(TestAiry, TryAiryFailures) {
+    std::complex<double> result;
+    EXPECT_EQ(
+        TryAiry(Z, kind, static_cast<AiryScaling>(-1), result),
+        ERROR__AIRY_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryAiry(Z, AiryKind::WONE, AiryScaling::NONE, result),
+        ERROR__AIRY_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryAiry(Z, static_cast<AiryKind>(0), scaling, result),
+        ERROR__AIRY_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryAiry({7.0, 6.0}, kind, scaling, result), ERROR__AIRY_RANGE
+    );
+
+    // The batch fails if any argument fails, and writes no results
+    const std::complex<double> args[] = {{1.0, 1.0}, {7.0, 6.0}};
+    std::complex<double> results[] = {{-1.0, 0.0}, {-1.0, 0.0}};
+    EXPECT_EQ(TryAiry(2, args, kind, scaling, results), ERROR__AIRY_RANGE);
+    EXPECT_EQ(results[0], std::complex<double>(-1.0, 0.0));
+
+    // Even when the failure is not among the first arguments sorted together
+    std::vector<std::complex<double>> many(1000, {1.0, 1.0});
+    many.back() = {7.0, 6.0};
+    std::vector<std::complex<double>> many_results(many.size(), {-1.0, 0.0});
+    EXPECT_EQ(
+        TryAiry(many.size(), many.data(), kind, scaling, many_results.data()),
+        ERROR__AIRY_RANGE
+    );
+    EXPECT_EQ(many_results[0], std::complex<double>(-1.0, 0.0));
+}
+
+/** The batch matches the scalar function for every kind and method */
+TEST_F(TestAiry, BatchMatchesScalar) {
+    // Arguments summed by the shifted Taylor series at many centers of
+    // expansion and by the asymptotic series, in all four quadrants, and
+    // more of them than are sorted together
+    std::vector<std::complex<double>> args;
+    for (double re = -9.0; re <= 9.0; re += 0.35) {
+        for (double im = -8.0; im <= 8.0; im += 0.9)
+            args.emplace_back(re, im);
+    }
+    args.emplace_back(25.0, -3.0);
+    args.emplace_back(0.0, 0.0);
+
+    const AiryKind kinds[] = {
+        AiryKind::AIRY,
+        AiryKind::AIRYD,
+        AiryKind::BAIRY,
+        AiryKind::BAIRYD,
+        AiryKind::WONE,
+        AiryKind::DWONE,
+        AiryKind::WTWO,
+        AiryKind::DWTWO
+    };
+    for (const AiryKind k : kinds) {
+        for (const AiryScaling s : {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+            // Skip arguments beyond the center of expansion data, for which
+            // both functions fail
+            std::vector<std::complex<double>> valid, expected_v;
+            for (const std::complex<double> &z : args) {
+                std::complex<double> expected_z;
+                if (TryAiry(z, k, s, expected_z) == SUCCESS) {
+                    expected_v.push_back(expected_z);
+                    valid.push_back(z);
+                }
+            }
+            ASSERT_GT(valid.size(), args.size() / 2);
+
+            std::vector<std::complex<double>> batch(valid.size());
+            Airy(valid.size(), valid.data(), k, s, batch.data());
+            for (std::size_t i = 0; i < valid.size(); i++) {
+                const std::complex<double> expected_i = expected_v[i];
+                if (!std::isfinite(std::abs(expected_i)))
+                    continue;  // Ai(0) is not defined by the asymptotic series
+                const double tol = 1e-13 * std::abs(expected_i);
+                EXPECT_NEAR(batch[i].real(), expected_i.real(), tol)
+                    << "Z = " << valid[i];
+                EXPECT_NEAR(batch[i].imag(), expected_i.imag(), tol)
+                    << "Z = " << valid[i];
+            }
+        }
+    }
+}
+
+#ifndef LFMF_NO_EXCEPTIONS
+/** The batch validates its arguments like the scalar function */
+TEST_F(TestAiry, BatchInvalidScaling) {
+    std::complex<double> result;
+    EXPECT_THROW(
+        Airy(1, &Z, AiryKind::WONE, AiryScaling::NONE, &result),
+        std::invalid_argument
+    );
+}
+#endif
+
+/** A pair is identical to the function and derivative found separately */
+TEST_F(TestAiry, PairMatchesSeparateCalls) {
+    std::vector<std::complex<double>> args;
+    for (double re = -9.0; re <= 9.0; re += 0.7) {
+        for (double im = -8.0; im <= 8.0; im += 0.9)
+            args.emplace_back(re, im);
+    }
+    args.emplace_back(25.0, -3.0);
+
+    const AiryKind kinds[][2] = {
+        {AiryKind::AIRY, AiryKind::AIRYD},
+        {AiryKind::BAIRY, AiryKind::BAIRYD},
+        {AiryKind::WONE, AiryKind::DWONE},
+        {AiryKind::WTWO, AiryKind::DWTWO}
+    };
+    for (const auto &k : kinds) {
+        for (const AiryScaling s : {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+            for (const std::complex<double> &z : args) {
+                std::complex<double> expected_f, expected_df;
+                const ReturnCode rtn = TryAiry(z, k[0], s, expected_f);
+                ASSERT_EQ(TryAiry(z, k[1], s, expected_df), rtn);
+
+                // Either the function or its derivative selects the pair
+                for (const AiryKind pair_kind : k) {
+                    std::complex<double> f, df;
+                    ASSERT_EQ(TryAiryPair(z, pair_kind, s, f, df), rtn);
+                    if (rtn != SUCCESS)
+                        continue;
+                    EXPECT_EQ(f, expected_f) << "Z = " << z;
+                    EXPECT_EQ(df, expected_df) << "Z = " << z;
+                }
+            }
+        }
+    }
+
+    std::complex<double> f, df;
+    EXPECT_EQ(
+        TryAiryPair(Z, AiryKind::WONE, AiryScaling::NONE, f, df),
+        ERROR__AIRY_ARGUMENT
+    );
+#ifndef LFMF_NO_EXCEPTIONS
+    EXPECT_THROW(
+        AiryPair({7.0, 6.0}, kind, scaling, f, df), std::range_error
+    );
+#endif
+}
+
+/** The tabulated functions agree with `Airy()` within each accuracy tier */
+TEST_F(TestAiry, FastMatchesAiry) {
+    // The arguments of the tests above and of `BatchMatchesScalar`, and ones
+    // along the ray of the residue series roots
+    std::vector<std::complex<double>> args
+        = {{8.0, 8.0}, {1.0, -2.0}, {-3.0, 0.5}};
+    for (double re = -9.0; re <= 9.0; re += 0.7) {
+        for (double im = -8.0; im <= 8.0; im += 0.9)
+            args.emplace_back(re, im);
+    }
+    const std::complex<double> ray(std::cos(PI / 3.0), -std::sin(PI / 3.0));
+    for (double re = -1.0; re >= -30.0; re -= 0.37) {
+        for (double im = -1.0; im <= 1.0; im += 0.23)
+            args.push_back(-std::complex<double>(re, im) * ray);
+    }
+
+    const AiryKind kinds[] = {
+        AiryKind::AIRY,
+        AiryKind::AIRYD,
+        AiryKind::BAIRY,
+        AiryKind::BAIRYD,
+        AiryKind::WONE,
+        AiryKind::DWONE,
+        AiryKind::WTWO,
+        AiryKind::DWTWO
+    };
+    const AiryAccuracy tiers[]
+        = {AiryAccuracy::LOW, AiryAccuracy::STANDARD, AiryAccuracy::HIGH};
+    // Agreement is limited by `Airy()` itself, about 1e-6 near the zeros of
+    // the functions; `FastTiersMeetTolerance` checks the tiers themselves
+    const double tols[] = {1e-3, 2e-6, 2e-6};
+    for (int t = 0; t < 3; t++) {
+        for (const AiryKind k : kinds) {
+            for (const AiryScaling s :
+                 {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+                for (const std::complex<double> &z : args) {
+                    std::complex<double> expected_z, fast;
+                    const ReturnCode rtn = TryAiry(z, k, s, expected_z);
+                    ASSERT_EQ(FastAiry(z, k, s, tiers[t], fast), rtn);
+                    if (rtn != SUCCESS)
+                        continue;
+                    const double tol = tols[t] * std::abs(expected_z);
+                    EXPECT_NEAR(fast.real(), expected_z.real(), tol)
+                        << "Z = " << z;
+                    EXPECT_NEAR(fast.imag(), expected_z.imag(), tol)
+                        << "Z = " << z;
+                }
+            }
+        }
+    }
+}
+
+/** Each tier is within its tolerance of the series it truncates */
+TEST_F(TestAiry, FastTiersMeetTolerance) {
+    // Each cell of the table holds the Taylor polynomial of Ai(Z) about its
+    // center, truncated at the least degree for which the remaining terms,
+    // bounded on the disk circumscribing the cell, are below the tolerance of
+    // the tier relative to the bound of the whole series. The reference is
+    // the same series, continued from the same center well beyond the degree
+    // of any tier, so that only the truncation error is measured.
+    const double step = 0.25;  // Side of the cells
+    const double real_min = -32.0;  // Least real part covered by the table
+    const double r = step * std::sqrt(0.5);  // Circumradius of the cells
+    const int n_terms = 80;
+
+    const AiryAccuracy tiers[]
+        = {AiryAccuracy::LOW, AiryAccuracy::STANDARD, AiryAccuracy::HIGH};
+    const double tols[] = {1e-4, 1e-8, 1e-13};
+    for (double re = -31.9; re < 8.0; re += 0.173) {
+        for (double im = -3.9; im < 4.0; im += 0.191) {
+            // Arguments below the real axis are found from their reflections
+            const std::complex<double> z(re, im);
+            const std::complex<double> center(
+                real_min + (std::floor((re - real_min) / step) + 0.5) * step,
+                (std::floor(std::abs(im) / step) + 0.5) * step
+            );
+            std::complex<double> a[n_terms];
+            if (TryAiryPair(
+                    center, AiryKind::AIRY, AiryScaling::NONE, a[0], a[1]
+                )
+                != SUCCESS)
+                continue;  // The cell is not usable
+            for (int k = 2; k < n_terms; k++) {
+                a[k] = center * a[k - 2];
+                if (k >= 3)
+                    a[k] += a[k - 3];
+                a[k] /= static_cast<double>(k * (k - 1));
+            }
+
+            const std::complex<double> w
+                = std::complex<double>(re, std::abs(im)) - center;
+            std::complex<double> f, df;
+            double bound = 0.0, dbound = 0.0;
+            for (int k = n_terms - 1; k >= 0; k--) {
+                df = df * w + f;
+                f = f * w + a[k];
+                bound += std::abs(a[k]) * std::pow(r, k);
+                dbound += k * std::abs(a[k]) * std::pow(r, k - 1);
+            }
+            if (im < 0) {
+                f = std::conj(f);
+                df = std::conj(df);
+            }
+
+            for (int t = 0; t < 3; t++) {
+                std::complex<double> fast, fast_d;
+                ASSERT_EQ(
+                    FastAiryPair(
+                        z,
+                        AiryKind::AIRY,
+                        AiryScaling::NONE,
+                        tiers[t],
+                        fast,
+                        fast_d
+                    ),
+                    SUCCESS
+                );
+                EXPECT_LE(std::abs(fast - f), tols[t] * bound)
+                    << "Z = " << z << ", tier " << t;
+                EXPECT_LE(std::abs(fast_d - df), tols[t] * dbound)
+                    << "Z = " << z << ", tier " << t;
+            }
+        }
+    }
+}
+
+/** A tabulated pair is identical to the tabulated functions found separately */
+TEST_F(TestAiry, FastPairMatchesFast) {
+    for (double re = -20.0; re <= 9.0; re += 1.3) {
+        const std::complex<double> z(re, 0.4);
+        std::complex<double> f, df, expected_f, expected_df;
+        EXPECT_EQ(
+            FastAiryPair(
+                z,
+                AiryKind::WONE,
+                AiryScaling::WAIT,
+                AiryAccuracy::STANDARD,
+                f,
+                df
+            ),
+            SUCCESS
+        );
+        EXPECT_EQ(
+            FastAiry(
+                z,
+                AiryKind::WONE,
+                AiryScaling::WAIT,
+                AiryAccuracy::STANDARD,
+                expected_f
+            ),
+            SUCCESS
+        );
+        EXPECT_EQ(
+            FastAiry(
+                z,
+                AiryKind::DWONE,
+                AiryScaling::WAIT,
+                AiryAccuracy::STANDARD,
+                expected_df
+            ),
+            SUCCESS
+        );
+        EXPECT_EQ(f, expected_f) << "Z = " << z;
+        EXPECT_EQ(df, expected_df) << "Z = " << z;
+    }
+}
+
+/** The tabulated functions report failures as `TryAiry()` */
+TEST_F(TestAiry, FastFailures) {
+    std::complex<double> result;
+    EXPECT_EQ(
+        FastAiry(Z, kind, scaling, static_cast<AiryAccuracy>(3), result),
+        ERROR__AIRY_ARGUMENT
+    );
+    EXPECT_EQ(
+        FastAiry(
+            Z, AiryKind::WONE, AiryScaling::NONE, AiryAccuracy::LOW, result
+        ),
+        ERROR__AIRY_ARGUMENT
+    );
+    EXPECT_EQ(
+        FastAiry({7.0, 6.0}, kind, scaling, AiryAccuracy::HIGH, result),
+        ERROR__AIRY_RANGE
+    );
+}
+
+/** Wait's w1 along the residue series agrees with `Airy()` */
+TEST_F(TestAiry, ResidueSeriesAiryMatchesAiry) {
+    // Roots lie near the ray arg(t) = -PI/3; height-gain arguments are
+    // shifted from the roots along the real axis
+    const std::complex<double> ray(std::cos(PI / 3.0), -std::sin(PI / 3.0));
+    std::vector<std::complex<double>> args;
+    for (double r = 1.0; r <= 40.0; r += 0.61) {
+        for (double y = 0.0; y <= 3.0; y += 0.75)
+            args.push_back(r * ray + std::complex<double>(-y, 0.3));
+    }
+    args.emplace_back(8.0, 8.0);  // Outside of the table
+
+    std::vector<std::complex<double>> batch(args.size());
+    EXPECT_EQ(
+        ResidueSeriesAiry(args.size(), args.data(), batch.data()), SUCCESS
+    );
+    for (std::size_t i = 0; i < args.size(); i++) {
+        const std::complex<double> expected_i
+            = Airy(args[i], AiryKind::WONE, AiryScaling::WAIT);
+        std::complex<double> w1;
+        EXPECT_EQ(ResidueSeriesAiry(args[i], w1), SUCCESS);
+        EXPECT_EQ(batch[i], w1) << "T = " << args[i];
+
+        const double tol = 2e-6 * std::abs(expected_i);
+        EXPECT_NEAR(w1.real(), expected_i.real(), tol) << "T = " << args[i];
+        EXPECT_NEAR(w1.imag(), expected_i.imag(), tol) << "T = " << args[i];
+    }
+    // The general routine is used outside of the table
+    EXPECT_EQ(
+        batch.back(), Airy(args.back(), AiryKind::WONE, AiryScaling::WAIT)
+    );
+}
+
+/** The functions which report failures by return code allocate no memory */
+TEST_F(TestAiry, TryFunctionsDoNotAllocate) {
+    // Arguments on and off the tables, over more than one batch chunk
+    std::vector<std::complex<double>> args;
+    for (double x = -36.0; x <= 6.0; x += 0.37) {
+        for (double y = -4.5; y <= 2.0; y += 0.9)
+            args.emplace_back(x, y);
+    }
+    std::vector<std::complex<double>> values(args.size());
+
+    const std::size_t before = allocations;
+    int failures = 0;
+    for (const std::complex<double> &z : args) {
+        std::complex<double> f, df;
+        failures += FastAiry(
+                        z, kind, scaling, AiryAccuracy::STANDARD, f
+                    ) != SUCCESS;
+        failures += FastAiryPair(
+                        z, kind, scaling, AiryAccuracy::HIGH, f, df
+                    ) != SUCCESS;
+        failures += ResidueSeriesAiry(z, f) != SUCCESS;
+        failures += TryAiry(z, kind, scaling, f) != SUCCESS;
+        failures += TryAiryPair(z, kind, scaling, f, df) != SUCCESS;
+    }
+    failures += TryAiry(
+                    args.size(), args.data(), kind, scaling, values.data()
+                ) != SUCCESS;
+    failures
+        += ResidueSeriesAiry(args.size(), args.data(), values.data()) != SUCCESS;
+    const std::size_t after = allocations;
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(after, before);
+}
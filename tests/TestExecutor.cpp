@@ -0,0 +1,125 @@
+/** @file TestExecutor.cpp
+ * Unit tests for the work-stealing thread pool.
+ */
+
+#include "TestUtils.h"
+
+#include <atomic>     // for std::atomic
+#include <cstddef>    // for std::size_t
+#include <stdexcept>  // for std::runtime_error
+#include <vector>     // for std::vector
+
+/** Every index is visited exactly once, for any thread count and chunking */
+TEST(TestExecutor, VisitsEveryIndexOnce) {
+    for (const unsigned int n_threads : {1u, 2u, 5u}) {
+        Executor executor(n_threads);
+        EXPECT_EQ(executor.GetThreadCount(), n_threads);
+        for (const std::size_t n : {0, 1, 10, 1000}) {
+            for (const std::size_t chunk_size : {0, 1, 3, 64, 5000}) {
+                std::vector<std::atomic<int>> visits(n);
+                for (auto &v : visits)
+                    v = 0;
+                executor.ParallelFor(
+                    n,
+                    chunk_size,
+                    [&](const std::size_t begin, const std::size_t end) {
+                        EXPECT_LT(begin, end);
+                        if (chunk_size != 0) {
+                            EXPECT_LE(end - begin, chunk_size);
+                        }
+                        for (std::size_t i = begin; i < end; i++)
+                            visits[i]++;
+                    }
+                );
+                for (std::size_t i = 0; i < n; i++)
+                    EXPECT_EQ(visits[i], 1) << "index " << i;
+            }
+        }
+    }
+}
+
+/** Threads with little work take chunks from threads with a lot */
+TEST(TestExecutor, UnevenWork) {
+    Executor executor(4);
+    const std::size_t n = 400;
+    std::vector<double> output(n);
+    executor.ParallelFor(
+        n,
+        1,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                // The first quarter of the indices is much more expensive
+                const int terms = (i < n / 4) ? 20000 : 10;
+                double sum = 0;
+                for (int k = 1; k <= terms; k++)
+                    sum += 1.0 / (static_cast<double>(k) * k);
+                output[i] = sum;
+            }
+        }
+    );
+    EXPECT_NEAR(output[0], 1.64488, 1e-4);
+    EXPECT_NEAR(output[n - 1], 1.54977, 1e-4);
+}
+
+#ifndef LFMF_NO_EXCEPTIONS
+/** The first exception thrown by the body is rethrown to the caller */
+TEST(TestExecutor, RethrowsException) {
+    Executor executor(3);
+    EXPECT_THROW(
+        executor.ParallelFor(
+            100,
+            1,
+            [](const std::size_t begin, const std::size_t) {
+                if (begin == 42)
+                    throw std::runtime_error("chunk 42 failed");
+            }
+        ),
+        std::runtime_error
+    );
+
+    // The executor can still be used afterwards
+    std::atomic<std::size_t> count(0);
+    executor.ParallelFor(
+        100,
+        1,
+        [&](const std::size_t begin, const std::size_t end) {
+            count += end - begin;
+        }
+    );
+    EXPECT_EQ(count, 100u);
+}
+#endif
+
+/** The shared pool of a thread count is started once and then reused */
+TEST(TestExecutor, SharedExecutorIsReused) {
+    Executor &pool = SharedExecutor(3);
+    EXPECT_EQ(&pool, &SharedExecutor(3));
+    EXPECT_NE(&pool, &SharedExecutor(2));
+    EXPECT_EQ(pool.GetThreadCount(), 3u);
+}
+
+/** A call from inside a body runs on the calling thread */
+TEST(TestExecutor, NestedCalls) {
+    Executor executor(4);
+    std::vector<std::atomic<int>> visits(20 * 20);
+    for (auto &v : visits)
+        v = 0;
+    executor.ParallelFor(
+        20,
+        1,
+        [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                executor.ParallelFor(
+                    20,
+                    3,
+                    [&](const std::size_t b, const std::size_t e) {
+                        for (std::size_t j = b; j < e; j++)
+                            visits[i * 20 + j]++;
+                    }
+                );
+            }
+        }
+    );
+    for (const auto &v : visits)
+        EXPECT_EQ(v, 1);
+}
@@ -0,0 +1,219 @@
+/** @file TestLFMFBatch.cpp
+ * Unit tests for the batched LFMF entry points.
+ */
+
+#include "TestUtils.h"
+
+#include <vector>  // for std::vector
+
+/*******************************************************************************
+ * Test fixture which provides a batch of paths mixing valid and invalid
+ * inputs, and both solution methods.
+ ******************************************************************************/
+class TestLFMFBatch: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            // clang-format off
+            //       h_tx   h_rx   f__mhz  P_tx    N_s    d__km   eps  sigma  pol
+            AddRow(   0.0,   0.0,  0.01,   1000,   301,   1000,   15,  0.005, 0);
+            AddRow(   0.0,   0.0,  0.01,   1000,   301,   10,     15,  0.005, 0);
+            AddRow(  10.0,   2.0,  1.0,    1000,   315,   50,     15,  0.005, 1);
+            AddRow(  10.0,   2.0,  1.0,    1000,   315,   500,    15,  0.005, 1);
+            AddRow(  60.0,   2.0,  1.0,    1000,   315,   500,    15,  0.005, 1);
+            AddRow(   5.0,  30.0,  1.0,    1000,   315,   500,    80,  5.0,   1);
+            AddRow(   5.0,  30.0,  1.0,    1000,   315,   500,    80,  5.0,   2);
+            AddRow(   5.0,  30.0,  20.0,   100,    350,   20,     4,   0.001, 0);
+            AddRow(   5.0,  30.0,  20.0,   100,    350,   20,     4,   -1.0,  0);
+            AddRow(   1.0,   1.0,  0.5,    10,     301,   200,    10,  0.01,  1);
+            // clang-format on
+        }
+
+        void AddRow(
+            const double h_tx,
+            const double h_rx,
+            const double f,
+            const double P_tx,
+            const double N,
+            const double d,
+            const double eps,
+            const double sig,
+            const int p
+        ) {
+            h_tx__meter.push_back(h_tx);
+            h_rx__meter.push_back(h_rx);
+            f__mhz.push_back(f);
+            P_tx__watt.push_back(P_tx);
+            N_s.push_back(N);
+            d__km.push_back(d);
+            epsilon.push_back(eps);
+            sigma.push_back(sig);
+            pol.push_back(p);
+        }
+
+        std::vector<double> h_tx__meter, h_rx__meter, f__mhz, P_tx__watt, N_s,
+            d__km, epsilon, sigma;
+        std::vector<int> pol;
+};
+
+/** Every row of the batch must match an independent call to LFMF() */
+TEST_F(TestLFMFBatch, MatchesSinglePointCalls) {
+    const std::size_t n = d__km.size();
+    std::vector<Result> results(n);
+    std::vector<ReturnCode> rtns(n);
+
+    const ReturnCode rtn = LFMFBatch(
+        n,
+        h_tx__meter.data(),
+        h_rx__meter.data(),
+        f__mhz.data(),
+        P_tx__watt.data(),
+        N_s.data(),
+        d__km.data(),
+        epsilon.data(),
+        sigma.data(),
+        pol.data(),
+        results.data(),
+        rtns.data()
+    );
+    // The first invalid row is the TX height of 60 meters
+    EXPECT_EQ(rtn, ERROR__TX_TERMINAL_HEIGHT);
+
+    for (std::size_t i = 0; i < n; i++) {
+        Result expected;
+        const ReturnCode expected_rtn = LFMF(
+            h_tx__meter[i],
+            h_rx__meter[i],
+            f__mhz[i],
+            P_tx__watt[i],
+            N_s[i],
+            d__km[i],
+            epsilon[i],
+            sigma[i],
+            pol[i],
+            expected
+        );
+        EXPECT_EQ(rtns[i], expected_rtn) << "Row " << i;
+        if (expected_rtn == SUCCESS) {
+            EXPECT_DOUBLE_EQ(results[i].A_btl__db, expected.A_btl__db);
+            EXPECT_DOUBLE_EQ(results[i].E_dBuVm, expected.E_dBuVm);
+            EXPECT_DOUBLE_EQ(results[i].P_rx__dbm, expected.P_rx__dbm);
+            EXPECT_EQ(results[i].method, expected.method);
+        }
+    }
+}
+
+/** Every invalid row must be reported, not only the first */
+TEST_F(TestLFMFBatch, ReportsEveryInvalidRow) {
+    const std::size_t n = d__km.size();
+    std::vector<Result> results(n);
+    std::vector<ReturnCode> rtns(n);
+
+    LFMFBatch(
+        n,
+        h_tx__meter.data(),
+        h_rx__meter.data(),
+        f__mhz.data(),
+        P_tx__watt.data(),
+        N_s.data(),
+        d__km.data(),
+        epsilon.data(),
+        sigma.data(),
+        pol.data(),
+        results.data(),
+        rtns.data()
+    );
+    EXPECT_EQ(rtns[4], ERROR__TX_TERMINAL_HEIGHT);
+    EXPECT_EQ(rtns[6], ERROR__POLARIZATION);
+    EXPECT_EQ(rtns[8], ERROR__SIGMA);
+    EXPECT_EQ(rtns[9], SUCCESS);
+}
+
+/** An empty batch succeeds without touching the outputs */
+TEST_F(TestLFMFBatch, EmptyBatch) {
+    const ReturnCode rtn = LFMFBatch_CPP(
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+    );
+    EXPECT_EQ(rtn, SUCCESS);
+}
+
+/** The threaded batch matches the single-threaded batch for any chunking */
+TEST_F(TestLFMFBatch, ParallelMatchesBatch) {
+    // Repeat the rows so that every thread gets several chunks
+    const std::size_t n_rows = d__km.size();
+    for (int rep = 0; rep < 20; rep++) {
+        for (std::size_t i = 0; i < n_rows; i++) {
+            AddRow(
+                h_tx__meter[i],
+                h_rx__meter[i],
+                f__mhz[i],
+                P_tx__watt[i],
+                N_s[i],
+                d__km[i] * (1 + 0.1 * rep),
+                epsilon[i],
+                sigma[i],
+                pol[i]
+            );
+        }
+    }
+    const std::size_t n = d__km.size();
+
+    std::vector<Result> expected(n);
+    std::vector<ReturnCode> expected_rtns(n);
+    const ReturnCode expected_rtn = LFMFBatch(
+        n,
+        h_tx__meter.data(),
+        h_rx__meter.data(),
+        f__mhz.data(),
+        P_tx__watt.data(),
+        N_s.data(),
+        d__km.data(),
+        epsilon.data(),
+        sigma.data(),
+        pol.data(),
+        expected.data(),
+        expected_rtns.data()
+    );
+
+    for (const unsigned int n_threads : {1u, 3u, 8u}) {
+        for (const std::size_t chunk_size : {0, 1, 7, 1000}) {
+            std::vector<Result> results(n);
+            std::vector<ReturnCode> rtns(n);
+            const ReturnCode rtn = LFMFBatchParallel(
+                n,
+                h_tx__meter.data(),
+                h_rx__meter.data(),
+                f__mhz.data(),
+                P_tx__watt.data(),
+                N_s.data(),
+                d__km.data(),
+                epsilon.data(),
+                sigma.data(),
+                pol.data(),
+                results.data(),
+                rtns.data(),
+                n_threads,
+                chunk_size
+            );
+            EXPECT_EQ(rtn, expected_rtn);
+            for (std::size_t i = 0; i < n; i++) {
+                ASSERT_EQ(rtns[i], expected_rtns[i]) << "row " << i;
+                if (rtns[i] == SUCCESS) {
+                    EXPECT_EQ(results[i].E_dBuVm, expected[i].E_dBuVm);
+                    EXPECT_EQ(results[i].A_btl__db, expected[i].A_btl__db);
+                    EXPECT_EQ(results[i].method, expected[i].method);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/** @file TestLFMFCoverage.cpp
+ * Unit tests for the polar grid coverage engine.
+ */
+
+#include "TestUtils.h"
+
+#include <cmath>    // for std::isnan
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+/** Test fixture provides radials of different lengths and ground constants */
+class TestLFMFCoverage: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            const double epsilon[] = {15, 80, 4, 15, 22, 5};
+            const double sigma[] = {0.005, 5, 0.001, 0.01, 0.003, 0.0005};
+            for (std::size_t i = 0; i < 6; i++) {
+                CoverageRadial radial;
+                radial.epsilon = epsilon[i];
+                radial.sigma = sigma[i];
+                for (double d = 1; d <= 400 + 100 * i; d *= 1.5)
+                    radial.d__km.push_back(d);
+                radials.push_back(radial);
+            }
+        }
+
+        /** Compare every cell of the grid to an independent LFMF_CPP() call */
+        void CompareToLFMF(const unsigned int n_threads) {
+            CoverageGrid grid;
+            const ReturnCode rtn = LFMFCoverage(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                pol,
+                radials,
+                n_threads,
+                grid
+            );
+            EXPECT_EQ(rtn, SUCCESS);
+            ASSERT_EQ(grid.n_radials, radials.size());
+            ASSERT_EQ(grid.n_distances, radials.back().d__km.size());
+            ASSERT_EQ(grid.E_dBuVm.size(), grid.n_radials * grid.n_distances);
+
+            for (std::size_t i = 0; i < grid.n_radials; i++) {
+                for (std::size_t j = 0; j < grid.n_distances; j++) {
+                    const std::size_t idx = i * grid.n_distances + j;
+                    if (j >= radials[i].d__km.size()) {
+                        EXPECT_TRUE(std::isnan(grid.d__km[idx]));
+                        EXPECT_TRUE(std::isnan(grid.E_dBuVm[idx]));
+                        continue;
+                    }
+                    Result result;
+                    result.A_btl__db = grid.A_btl__db[idx];
+                    result.E_dBuVm = grid.E_dBuVm[idx];
+                    result.P_rx__dbm = grid.P_rx__dbm[idx];
+                    EXPECT_DOUBLE_EQ(grid.d__km[idx], radials[i].d__km[j]);
+                    ExpectMatchesLFMF(
+                        {h_tx__meter,
+                         h_rx__meter,
+                         f__mhz,
+                         SWEEP_P_TX__WATT,
+                         SWEEP_N_S,
+                         radials[i].d__km[j],
+                         radials[i].epsilon,
+                         radials[i].sigma,
+                         pol},
+                        grid.rtns[idx],
+                        result,
+                        0.0,
+                        false
+                    );
+                }
+            }
+        }
+
+        const double h_tx__meter = 10;
+        const double h_rx__meter = 2;
+        const double f__mhz = 1.0;
+        const Polarization pol = Polarization::VERTICAL;
+        std::vector<CoverageRadial> radials;
+};
+
+/** Results do not depend on the number of threads */
+TEST_F(TestLFMFCoverage, MatchesLFMF) {
+    CompareToLFMF(1);
+    CompareToLFMF(4);
+    CompareToLFMF(0);
+}
+
+/** Invalid cells are reported in storage order */
+TEST_F(TestLFMFCoverage, InvalidCells) {
+    radials[2].sigma = -1;
+    radials[4].d__km[0] = 0;
+    CoverageGrid grid;
+    const ReturnCode rtn = LFMFCoverage(
+        h_tx__meter,
+        h_rx__meter,
+        f__mhz,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        pol,
+        radials,
+        3,
+        grid
+    );
+    EXPECT_EQ(rtn, ERROR__SIGMA);
+    EXPECT_EQ(grid.rtns[2 * grid.n_distances], ERROR__SIGMA);
+    EXPECT_EQ(grid.rtns[4 * grid.n_distances], ERROR__PATH_DISTANCE);
+    EXPECT_EQ(grid.rtns[4 * grid.n_distances + 1], SUCCESS);
+}
+
+/** An empty set of radials gives an empty grid */
+TEST_F(TestLFMFCoverage, NoRadials) {
+    radials.clear();
+    CoverageGrid grid;
+    EXPECT_EQ(
+        LFMFCoverage(
+            h_tx__meter,
+            h_rx__meter,
+            f__mhz,
+            SWEEP_P_TX__WATT,
+            SWEEP_N_S,
+            pol,
+            radials,
+            4,
+            grid
+        ),
+        SUCCESS
+    );
+    EXPECT_EQ(grid.n_radials, 0u);
+    EXPECT_TRUE(grid.E_dBuVm.empty());
+}
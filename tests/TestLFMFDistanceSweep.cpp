@@ -0,0 +1,127 @@
+/** @file TestLFMFDistanceSweep.cpp
+ * Unit tests for the distance sweep entry point.
+ */
+
+#include "TestUtils.h"
+
+#include <vector>  // for std::vector
+
+/** Test fixture provides distances spanning both solution methods */
+class TestLFMFDistanceSweep: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            // Includes invalid distances and distances on both sides of the
+            // crossover distance for every frequency used in these tests
+            d__km = {0.0001, 0.5, 5, 20, 50, 80, 120, 300, 1000, 5000, 20000};
+        }
+
+        /** Compare each point of a sweep to an independent LFMF_CPP() call */
+        void CompareToLFMF(
+            const double h_tx__meter,
+            const double h_rx__meter,
+            const double f__mhz,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        ) {
+            const ReturnCode rtn = LFMFDistanceSweep(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                d__km,
+                epsilon,
+                sigma,
+                pol,
+                results,
+                rtns
+            );
+            EXPECT_EQ(rtn, ERROR__PATH_DISTANCE);
+            ASSERT_EQ(results.size(), d__km.size());
+            ASSERT_EQ(rtns.size(), d__km.size());
+
+            for (std::size_t i = 0; i < d__km.size(); i++) {
+                ExpectMatchesLFMF(
+                    {h_tx__meter,
+                     h_rx__meter,
+                     f__mhz,
+                     SWEEP_P_TX__WATT,
+                     SWEEP_N_S,
+                     d__km[i],
+                     epsilon,
+                     sigma,
+                     pol},
+                    rtns[i],
+                    results[i]
+                );
+            }
+        }
+
+        std::vector<double> d__km;
+        std::vector<Result> results;
+        std::vector<ReturnCode> rtns;
+};
+
+/** Ground-level antennas, horizontal polarization */
+TEST_F(TestLFMFDistanceSweep, GroundLevelAntennas) {
+    CompareToLFMF(0, 0, 0.01, 15, 0.005, Polarization::HORIZONTAL);
+    CompareToLFMF(0, 0, 1.0, 15, 0.005, Polarization::HORIZONTAL);
+}
+
+/** Elevated antennas, vertical polarization */
+TEST_F(TestLFMFDistanceSweep, ElevatedAntennas) {
+    CompareToLFMF(10, 2, 1.0, 80, 5, Polarization::VERTICAL);
+    CompareToLFMF(2, 40, 10.0, 4, 0.001, Polarization::VERTICAL);
+}
+
+/** Invalid inputs other than distance are reported at every point */
+TEST_F(TestLFMFDistanceSweep, InvalidFrequency) {
+    const ReturnCode rtn = LFMFDistanceSweep(
+        0,
+        0,
+        100.0,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        d__km,
+        15,
+        0.005,
+        Polarization::HORIZONTAL,
+        results,
+        rtns
+    );
+    EXPECT_EQ(rtn, ERROR__FREQUENCY);
+    for (const auto &r : rtns) {
+        EXPECT_NE(r, SUCCESS);
+    }
+}
+
+/** Summing many distances together matches summing each distance alone */
+TEST_F(TestLFMFDistanceSweep, BlockedResidueSeries) {
+    PropagationConstants constants;
+    ComputePropagationConstants(
+        1.0, SWEEP_N_S, 15, 0.005, Polarization::VERTICAL, constants
+    );
+
+    // Several full blocks and a partial block of distances, out of order
+    std::vector<double> x;
+    for (int i = 0; i < 29; i++) {
+        const double d = constants.d_test__km + 37.0 * ((i * 11) % 29);
+        x.push_back(constants.nu * d / constants.a_e__km);
+    }
+
+    ResidueSeriesModes modes;
+    InitializeResidueSeriesModes(
+        constants.k, 0.002, 0.03, constants.nu, constants.q, modes
+    );
+    std::vector<double> E_gw(x.size());
+    ResidueSeriesFields(modes, x.size(), x.data(), E_gw.data());
+
+    for (std::size_t i = 0; i < x.size(); i++) {
+        ResidueSeriesModes single;
+        InitializeResidueSeriesModes(
+            constants.k, 0.002, 0.03, constants.nu, constants.q, single
+        );
+        EXPECT_EQ(E_gw[i], ResidueSeriesField(single, x[i])) << "x = " << x[i];
+    }
+}
@@ -0,0 +1,161 @@
+/** @file TestLFMFFrequencySweep.cpp
+ * Unit tests for the frequency sweep entry point.
+ */
+
+#include "TestUtils.h"
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+/** Test fixture provides an AM broadcast band frequency sweep */
+class TestLFMFFrequencySweep: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            // 530 to 1700 kHz in 10 kHz steps
+            for (int f__khz = 530; f__khz <= 1700; f__khz += 10)
+                f__mhz.push_back(f__khz / 1000.0);
+        }
+
+        /** Compare each point of a sweep to an independent LFMF_CPP() call */
+        void CompareToLFMF(
+            const double h_tx__meter,
+            const double h_rx__meter,
+            const double d__km,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        ) {
+            long newton_iterations;
+            const ReturnCode rtn = LFMFFrequencySweep(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                d__km,
+                epsilon,
+                sigma,
+                pol,
+                results,
+                rtns,
+                newton_iterations
+            );
+            EXPECT_EQ(rtn, SUCCESS);
+            ASSERT_EQ(results.size(), f__mhz.size());
+            ASSERT_EQ(rtns.size(), f__mhz.size());
+
+            for (std::size_t i = 0; i < f__mhz.size(); i++) {
+                ExpectMatchesLFMF(
+                    {h_tx__meter,
+                     h_rx__meter,
+                     f__mhz[i],
+                     SWEEP_P_TX__WATT,
+                     SWEEP_N_S,
+                     d__km,
+                     epsilon,
+                     sigma,
+                     pol},
+                    rtns[i],
+                    results[i],
+                    ABSTOL_DBL
+                );
+            }
+        }
+
+        /** Total Newton iterations of one sweep per frequency */
+        long IndependentIterations(
+            const double h_tx__meter,
+            const double h_rx__meter,
+            const double d__km,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        ) {
+            long total = 0;
+            for (const double f : f__mhz) {
+                long newton_iterations;
+                LFMFFrequencySweep(
+                    h_tx__meter,
+                    h_rx__meter,
+                    {f},
+                    SWEEP_P_TX__WATT,
+                    SWEEP_N_S,
+                    d__km,
+                    epsilon,
+                    sigma,
+                    pol,
+                    results,
+                    rtns,
+                    newton_iterations
+                );
+                total += newton_iterations;
+            }
+            return total;
+        }
+
+        std::vector<double> f__mhz;
+        std::vector<Result> results;
+        std::vector<ReturnCode> rtns;
+};
+
+/** Ground-level antennas, long path over land */
+TEST_F(TestLFMFFrequencySweep, GroundLevelAntennas) {
+    CompareToLFMF(0, 0, 500, 15, 0.005, Polarization::VERTICAL);
+}
+
+/** Elevated antennas over sea water */
+TEST_F(TestLFMFFrequencySweep, ElevatedAntennas) {
+    CompareToLFMF(30, 2, 300, 80, 5, Polarization::VERTICAL);
+}
+
+/** Paths which switch solution method partway through the sweep */
+TEST_F(TestLFMFFrequencySweep, MixedSolutionMethods) {
+    CompareToLFMF(0, 0, 80, 15, 0.005, Polarization::HORIZONTAL);
+}
+
+/** Continuation finds the roots in fewer Newton iterations */
+TEST_F(TestLFMFFrequencySweep, FewerNewtonIterations) {
+    long newton_iterations;
+    LFMFFrequencySweep(
+        0,
+        0,
+        f__mhz,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        500,
+        15,
+        0.005,
+        Polarization::VERTICAL,
+        results,
+        rtns,
+        newton_iterations
+    );
+    const long independent
+        = IndependentIterations(0, 0, 500, 15, 0.005, Polarization::VERTICAL);
+    EXPECT_GT(newton_iterations, 0);
+    EXPECT_LT(newton_iterations, independent);
+}
+
+/** Invalid frequencies are reported without stopping the sweep */
+TEST_F(TestLFMFFrequencySweep, InvalidFrequency) {
+    f__mhz = {0.5, 100.0, 0.6};
+    long newton_iterations;
+    const ReturnCode rtn = LFMFFrequencySweep(
+        0,
+        0,
+        f__mhz,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        500,
+        15,
+        0.005,
+        Polarization::VERTICAL,
+        results,
+        rtns,
+        newton_iterations
+    );
+    EXPECT_EQ(rtn, ERROR__FREQUENCY);
+    EXPECT_EQ(rtns[0], SUCCESS);
+    EXPECT_EQ(rtns[1], ERROR__FREQUENCY);
+    EXPECT_EQ(rtns[2], SUCCESS);
+}
@@ -0,0 +1,154 @@
+/** @file TestLFMFGroundSweep.cpp
+ * Unit tests for the ground constant sweep entry point.
+ */
+
+#include "TestUtils.h"
+
+#include <cmath>    // for std::pow
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+/** Test fixture provides a grid of ground constants */
+class TestLFMFGroundSweep: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            for (int i = 0; i < 8; i++)
+                epsilon.push_back(4 + 10 * i);
+            // Conductivity from 0.001 to 5 S/m, log spaced
+            for (int j = 0; j < 25; j++)
+                sigma.push_back(0.001 * std::pow(5000.0, j / 24.0));
+        }
+
+        /** Compare each grid point to an independent LFMF_CPP() call */
+        void CompareToLFMF(
+            const double h_tx__meter,
+            const double h_rx__meter,
+            const double f__mhz,
+            const double d__km,
+            const Polarization pol
+        ) {
+            long newton_iterations;
+            const ReturnCode rtn = LFMFGroundSweep(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                d__km,
+                epsilon,
+                sigma,
+                pol,
+                results,
+                rtns,
+                newton_iterations
+            );
+            EXPECT_EQ(rtn, SUCCESS);
+            ASSERT_EQ(results.size(), epsilon.size() * sigma.size());
+            ASSERT_EQ(rtns.size(), epsilon.size() * sigma.size());
+
+            for (std::size_t i = 0; i < epsilon.size(); i++) {
+                for (std::size_t j = 0; j < sigma.size(); j++) {
+                    const std::size_t idx = i * sigma.size() + j;
+                    ExpectMatchesLFMF(
+                        {h_tx__meter,
+                         h_rx__meter,
+                         f__mhz,
+                         SWEEP_P_TX__WATT,
+                         SWEEP_N_S,
+                         d__km,
+                         epsilon[i],
+                         sigma[j],
+                         pol},
+                        rtns[idx],
+                        results[idx],
+                        ABSTOL_DBL
+                    );
+                }
+            }
+        }
+
+        std::vector<double> epsilon;
+        std::vector<double> sigma;
+        std::vector<Result> results;
+        std::vector<ReturnCode> rtns;
+};
+
+/** Ground-level antennas, vertical polarization */
+TEST_F(TestLFMFGroundSweep, GroundLevelAntennas) {
+    CompareToLFMF(0, 0, 1.0, 400, Polarization::VERTICAL);
+}
+
+/** Elevated antennas, horizontal polarization */
+TEST_F(TestLFMFGroundSweep, ElevatedAntennas) {
+    CompareToLFMF(20, 5, 0.2, 1000, Polarization::HORIZONTAL);
+}
+
+/** Continuation finds the roots in fewer Newton iterations */
+TEST_F(TestLFMFGroundSweep, FewerNewtonIterations) {
+    long newton_iterations;
+    LFMFGroundSweep(
+        0,
+        0,
+        1.0,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        400,
+        epsilon,
+        sigma,
+        Polarization::VERTICAL,
+        results,
+        rtns,
+        newton_iterations
+    );
+
+    // Each single point sweep finds its roots from the Airy zeros
+    long independent = 0;
+    for (const double e : epsilon) {
+        for (const double s : sigma) {
+            long point_iterations;
+            LFMFGroundSweep(
+                0,
+                0,
+                1.0,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                400,
+                {e},
+                {s},
+                Polarization::VERTICAL,
+                results,
+                rtns,
+                point_iterations
+            );
+            independent += point_iterations;
+        }
+    }
+    EXPECT_GT(newton_iterations, 0);
+    EXPECT_LT(newton_iterations, independent);
+}
+
+/** Invalid ground constants are reported in storage order */
+TEST_F(TestLFMFGroundSweep, InvalidGroundConstants) {
+    epsilon = {15, 0};
+    sigma = {0.005, -1, 0.01};
+    long newton_iterations;
+    const ReturnCode rtn = LFMFGroundSweep(
+        0,
+        0,
+        1.0,
+        SWEEP_P_TX__WATT,
+        SWEEP_N_S,
+        400,
+        epsilon,
+        sigma,
+        Polarization::VERTICAL,
+        results,
+        rtns,
+        newton_iterations
+    );
+    EXPECT_EQ(rtn, ERROR__SIGMA);
+    EXPECT_EQ(rtns[0], SUCCESS);
+    EXPECT_EQ(rtns[1], ERROR__SIGMA);
+    EXPECT_EQ(rtns[2], SUCCESS);
+    EXPECT_EQ(rtns[3], ERROR__EPSILON);
+}
@@ -0,0 +1,77 @@
+/** @file TestLFMFHeightSweep.cpp
+ * Unit tests for the receiver height sweep entry point.
+ */
+
+#include "TestUtils.h"
+
+#include <vector>  // for std::vector
+
+/** Test fixture provides receiver heights and distances for both methods */
+class TestLFMFHeightSweep: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            h_rx__meter = {0, 1, 5, 10, 25, 50, 60};
+            d__km = {5, 40, 200, 1000};
+        }
+
+        /** Compare each point of a sweep to an independent LFMF_CPP() call */
+        void CompareToLFMF(
+            const double h_tx__meter,
+            const double f__mhz,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        ) {
+            const ReturnCode rtn = LFMFHeightSweep(
+                h_tx__meter,
+                h_rx__meter,
+                f__mhz,
+                SWEEP_P_TX__WATT,
+                SWEEP_N_S,
+                d__km,
+                epsilon,
+                sigma,
+                pol,
+                results,
+                rtns
+            );
+            EXPECT_EQ(rtn, ERROR__RX_TERMINAL_HEIGHT);
+            ASSERT_EQ(results.size(), h_rx__meter.size() * d__km.size());
+            ASSERT_EQ(rtns.size(), h_rx__meter.size() * d__km.size());
+
+            for (std::size_t i = 0; i < h_rx__meter.size(); i++) {
+                for (std::size_t j = 0; j < d__km.size(); j++) {
+                    const std::size_t idx = i * d__km.size() + j;
+                    ExpectMatchesLFMF(
+                        {h_tx__meter,
+                         h_rx__meter[i],
+                         f__mhz,
+                         SWEEP_P_TX__WATT,
+                         SWEEP_N_S,
+                         d__km[j],
+                         epsilon,
+                         sigma,
+                         pol},
+                        rtns[idx],
+                        results[idx]
+                    );
+                }
+            }
+        }
+
+        std::vector<double> h_rx__meter;
+        std::vector<double> d__km;
+        std::vector<Result> results;
+        std::vector<ReturnCode> rtns;
+};
+
+/** Transmitter at ground level */
+TEST_F(TestLFMFHeightSweep, GroundLevelTransmitter) {
+    CompareToLFMF(0, 1.0, 15, 0.005, Polarization::VERTICAL);
+}
+
+/** Receiver heights both below and above the transmitter */
+TEST_F(TestLFMFHeightSweep, ElevatedTransmitter) {
+    CompareToLFMF(10, 1.0, 80, 5, Polarization::VERTICAL);
+    CompareToLFMF(10, 3.0, 4, 0.001, Polarization::HORIZONTAL);
+}
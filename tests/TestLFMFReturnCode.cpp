@@ -248,4 +248,18 @@ TEST_F(TestLFMFReturnCode, InvalidPolarization) {
     }
     // Ensure this test was exercised by at least one test case
     EXPECT_EQ(polarization_checked, true);
-}
\ No newline at end of file
+}
+
+/** Numerical failures have status messages */
+TEST(TestLFMFReturnStatus, NumericalFailureMessages) {
+    for (const ReturnCode code :
+         {ERROR__AIRY_ARGUMENT,
+          ERROR__AIRY_RANGE,
+          ERROR__WIROOT_ARGUMENT,
+          ERROR__WIROOT_CONVERGENCE}) {
+        EXPECT_EQ(
+            GetReturnStatus(code).find("Undefined return code"),
+            std::string::npos
+        ) << "code = " << code;
+    }
+}
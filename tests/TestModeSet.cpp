@@ -0,0 +1,141 @@
+/** @file TestModeSet.cpp
+ * Unit tests for the reusable residue series mode set.
+ */
+
+#include "TestUtils.h"
+
+#include <thread>  // for std::thread
+#include <vector>  // for std::vector
+
+/** Test fixture provides paths covering both solution methods */
+class TestModeSet: public ::testing::Test {
+    protected:
+        /** Compare many paths of one mode set to LFMF_CPP() calls */
+        void CompareToLFMF(
+            const double f__mhz,
+            const double epsilon,
+            const double sigma,
+            const Polarization pol
+        ) {
+            const ModeSet modes(f__mhz, SWEEP_N_S, epsilon, sigma, pol);
+            ASSERT_EQ(modes.GetStatus(), SUCCESS);
+
+            for (const double d : d__km) {
+                for (const double h_tx : h__meter) {
+                    for (const double h_rx : h__meter) {
+                        Result result;
+                        const ReturnCode rtn = modes.Evaluate(
+                            h_tx, h_rx, SWEEP_P_TX__WATT, d, result
+                        );
+                        ExpectMatchesLFMF(
+                            {h_tx,
+                             h_rx,
+                             f__mhz,
+                             SWEEP_P_TX__WATT,
+                             SWEEP_N_S,
+                             d,
+                             epsilon,
+                             sigma,
+                             pol},
+                            rtn,
+                            result
+                        );
+                    }
+                }
+            }
+        }
+
+        // Distances out of order, so that roots are found by several calls
+        const std::vector<double> d__km = {300, 20, 5000, 80, 1000, 150};
+        const std::vector<double> h__meter = {0, 2, 30};
+};
+
+/** Results match LFMF_CPP() for land and sea paths */
+TEST_F(TestModeSet, MatchesLFMF) {
+    CompareToLFMF(0.1, 15, 0.005, Polarization::VERTICAL);
+    CompareToLFMF(1.0, 80, 5, Polarization::VERTICAL);
+    CompareToLFMF(5.0, 4, 0.001, Polarization::HORIZONTAL);
+}
+
+/** Roots are found once and kept */
+TEST_F(TestModeSet, KeepsRoots) {
+    const ModeSet modes(1.0, SWEEP_N_S, 15, 0.005, Polarization::VERTICAL);
+    std::vector<std::complex<double>> T, W1;
+    modes.GetRoots(T, W1);
+    EXPECT_TRUE(T.empty());
+
+    Result result;
+    EXPECT_EQ(modes.Evaluate(0, 0, SWEEP_P_TX__WATT, 80, result), SUCCESS);
+    modes.GetRoots(T, W1);
+    const std::size_t n_roots = T.size();
+    EXPECT_GT(n_roots, 0u);
+    EXPECT_EQ(W1.size(), n_roots);
+
+    // A longer path needs no more roots than a shorter one
+    EXPECT_EQ(modes.Evaluate(0, 0, SWEEP_P_TX__WATT, 2000, result), SUCCESS);
+    modes.GetRoots(T, W1);
+    EXPECT_EQ(T.size(), n_roots);
+}
+
+/** Invalid inputs give the same return codes as LFMF_CPP() */
+TEST_F(TestModeSet, InvalidInputs) {
+    Result result;
+    const ModeSet bad_f(100, SWEEP_N_S, 15, 0.005, Polarization::VERTICAL);
+    EXPECT_EQ(bad_f.GetStatus(), ERROR__FREQUENCY);
+    EXPECT_EQ(
+        bad_f.Evaluate(0, 0, SWEEP_P_TX__WATT, 100, result), ERROR__FREQUENCY
+    );
+    // Heights are checked before frequency, as in LFMF_CPP()
+    EXPECT_EQ(
+        bad_f.Evaluate(-1, 0, SWEEP_P_TX__WATT, 100, result),
+        ERROR__TX_TERMINAL_HEIGHT
+    );
+
+    const ModeSet bad_pol(
+        1.0, SWEEP_N_S, 15, 0.005, static_cast<Polarization>(2)
+    );
+    EXPECT_EQ(bad_pol.GetStatus(), ERROR__POLARIZATION);
+
+    const ModeSet modes(1.0, SWEEP_N_S, 15, 0.005, Polarization::VERTICAL);
+    EXPECT_EQ(
+        modes.Evaluate(0, 0, SWEEP_P_TX__WATT, 0, result), ERROR__PATH_DISTANCE
+    );
+    EXPECT_EQ(modes.Evaluate(0, 0, 0, 100, result), ERROR__TX_POWER);
+}
+
+/** Concurrent evaluations give the same results as sequential ones */
+TEST_F(TestModeSet, ConcurrentEvaluate) {
+    const ModeSet modes(0.5, SWEEP_N_S, 15, 0.005, Polarization::VERTICAL);
+    std::vector<double> d;
+    for (int i = 1; i <= 40; i++)
+        d.push_back(50.0 * i);
+
+    std::vector<std::vector<Result>> results(4, std::vector<Result>(d.size()));
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); t++) {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = 0; i < d.size(); i++)
+                modes.Evaluate(0, 10, SWEEP_P_TX__WATT, d[i], results[t][i]);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (std::size_t i = 0; i < d.size(); i++) {
+        Result expected;
+        LFMF_CPP(
+            0,
+            10,
+            0.5,
+            SWEEP_P_TX__WATT,
+            SWEEP_N_S,
+            d[i],
+            15,
+            0.005,
+            Polarization::VERTICAL,
+            expected
+        );
+        for (const auto &thread_results : results)
+            EXPECT_DOUBLE_EQ(thread_results[i].E_dBuVm, expected.E_dBuVm);
+    }
+}
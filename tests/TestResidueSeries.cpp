@@ -0,0 +1,242 @@
+/** @file TestResidueSeries.cpp
+ * Unit tests for the residue series and its options.
+ */
+
+#include "TestUtils.h"
+
+#include <cmath>    // for std::log10, std::sqrt
+#include <complex>  // for std::complex
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+/** Test fixture restores the default residue series options after each test */
+class TestResidueSeries: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            ClearRootCache();
+        }
+
+        void TearDown() override {
+            SetResidueSeriesOptions(ResidueSeriesOptions());
+        }
+
+        /** Normalized distances from the crossover distance outward */
+        std::vector<double> Distances(
+            const PropagationConstants &constants,
+            const std::size_t n,
+            const double step__km
+        ) {
+            std::vector<double> x;
+            for (std::size_t i = 0; i < n; i++) {
+                const double d = constants.d_test__km + step__km * i;
+                x.push_back(constants.nu * d / constants.a_e__km);
+            }
+            return x;
+        }
+
+        /** Prepare the modes of ground-level antennas */
+        void Initialize(
+            const PropagationConstants &constants, ResidueSeriesModes &modes
+        ) {
+            InitializeResidueSeriesModes(
+                constants.k, 0.002, 0.03, constants.nu, constants.q, modes
+            );
+        }
+};
+
+/** The options are off by default, and are kept as they are set */
+TEST_F(TestResidueSeries, Options) {
+    ResidueSeriesOptions options;
+    GetResidueSeriesOptions(options);
+    EXPECT_EQ(options.root_block, 0u);
+    EXPECT_FALSE(options.accelerate);
+
+    options.root_block = 8;
+    options.accelerate = true;
+    SetResidueSeriesOptions(options);
+    ResidueSeriesOptions stored;
+    GetResidueSeriesOptions(stored);
+    EXPECT_EQ(stored.root_block, 8u);
+    EXPECT_TRUE(stored.accelerate);
+
+    // New modes take the options
+    PropagationConstants constants;
+    ComputePropagationConstants(
+        1.0, 301, 15, 0.005, Polarization::VERTICAL, constants
+    );
+    ResidueSeriesModes modes;
+    Initialize(constants, modes);
+    EXPECT_EQ(modes.roots.root_block, 8u);
+    EXPECT_TRUE(modes.accelerate);
+}
+
+/** Every lane of the blocked sum agrees with a direct sum of the series */
+TEST_F(TestResidueSeries, FieldsMatchDirectSum) {
+    PropagationConstants constants;
+    ComputePropagationConstants(
+        1.0, 301, 15, 0.005, Polarization::VERTICAL, constants
+    );
+    // Not a whole number of blocks, so that the last block is partly empty
+    const std::vector<double> x = Distances(constants, 13, 150.0);
+
+    ResidueSeriesModes modes;
+    Initialize(constants, modes);
+    std::vector<double> E_gw(x.size());
+    ResidueSeriesFields(modes, x.size(), x.data(), E_gw.data());
+    ASSERT_EQ(modes.roots.status, SUCCESS);
+
+    for (std::size_t i = 0; i < x.size(); i++) {
+        std::complex<double> GW(0.0, 0.0);
+        for (std::size_t m = 0; m < modes.W.size(); m++) {
+            const std::complex<double> G
+                = std::exp(std::complex<double>(0.0, -x[i]) * modes.roots.T[m])
+                * modes.W[m];
+            GW += G;
+            const std::complex<double> change = G / GW;
+            if (m > 0 && std::abs(change.real()) + std::abs(change.imag())
+                             < 0.0005)
+                break;
+        }
+        const double E = std::abs(
+            std::sqrt(x[i]) * std::complex<double>(1.0, -1.0)
+            * std::sqrt(PI / 2) * GW
+        );
+        EXPECT_NEAR(E_gw[i], E, 1.0e-12 * E) << "x = " << x[i];
+    }
+}
+
+/** Finding the roots a block at a time gives the same field strengths */
+TEST_F(TestResidueSeries, RootBlocks) {
+    PropagationConstants constants;
+    ComputePropagationConstants(
+        1.0, 301, 15, 0.005, Polarization::VERTICAL, constants
+    );
+    const std::vector<double> x = Distances(constants, 16, 50.0);
+
+    ResidueSeriesModes modes, blocked;
+    Initialize(constants, modes);
+    ResidueSeriesOptions options;
+    options.root_block = 8;
+    SetResidueSeriesOptions(options);
+    Initialize(constants, blocked);
+    std::vector<double> E_gw(x.size()), E_blocked(x.size());
+    ResidueSeriesFields(modes, x.size(), x.data(), E_gw.data());
+    ResidueSeriesFields(blocked, x.size(), x.data(), E_blocked.data());
+
+    ASSERT_EQ(blocked.roots.status, SUCCESS);
+    ASSERT_GE(blocked.roots.T.size(), modes.roots.T.size());
+    for (std::size_t i = 0; i < modes.roots.T.size(); i++) {
+        EXPECT_NEAR(
+            std::abs(blocked.roots.T[i] - modes.roots.T[i]),
+            0.0,
+            0.5e-6 * std::abs(modes.roots.T[i])
+        ) << "i = " << i;
+    }
+    for (std::size_t i = 0; i < x.size(); i++)
+        EXPECT_NEAR(E_blocked[i], E_gw[i], 1.0e-6 * E_gw[i]) << "x = " << x[i];
+}
+
+/** Predictions with roots found a block at a time agree with the default */
+TEST_F(TestResidueSeries, RootBlocksOption) {
+    const double f__mhz[] = {0.01, 1.0, 10.0};
+    const double d__km[] = {300, 2000};
+    const Polarization pol = Polarization::VERTICAL;
+    std::vector<Result> expected;
+    for (const double f : f__mhz) {
+        for (const double d : d__km) {
+            Result result;
+            LFMF_CPP(0, 10, f, 1000, 301, d, 15, 0.005, pol, result);
+            expected.push_back(result);
+        }
+    }
+
+    ResidueSeriesOptions options;
+    options.root_block = 8;
+    SetResidueSeriesOptions(options);
+    std::size_t idx = 0;
+    for (const double f : f__mhz) {
+        for (const double d : d__km) {
+            Result result;
+            EXPECT_EQ(
+                LFMF_CPP(0, 10, f, 1000, 301, d, 15, 0.005, pol, result),
+                SUCCESS
+            );
+            EXPECT_NEAR(result.E_dBuVm, expected[idx].E_dBuVm, 1.0e-5)
+                << "f__mhz = " << f << ", d__km = " << d;
+            EXPECT_EQ(result.method, expected[idx].method);
+            idx++;
+        }
+    }
+}
+
+/** The accelerated series needs fewer modes near the crossover distance, and
+ * stays within 0.02 dB of the series, across frequency and ground constants */
+TEST_F(TestResidueSeries, AcceleratedSeries) {
+    // Average ground, and the low-frequency, sea water, and high-conductivity
+    // corners of the inputs
+    const double f__mhz[] = {1.0, 0.01, 1.0, 30.0};
+    const double epsilon[] = {15, 15, 80, 15};
+    const double sigma[] = {0.005, 0.005, 5, 10};
+    for (std::size_t c = 0; c < 4; c++) {
+        for (const Polarization pol :
+             {Polarization::HORIZONTAL, Polarization::VERTICAL}) {
+            SetResidueSeriesOptions(ResidueSeriesOptions());
+            PropagationConstants constants;
+            ComputePropagationConstants(
+                f__mhz[c], 301, epsilon[c], sigma[c], pol, constants
+            );
+            const std::vector<double> x
+                = Distances(constants, 8, 0.25 * constants.d_test__km);
+
+            ResidueSeriesOptions options;
+            options.accelerate = true;
+            std::vector<double> E_gw(x.size()), E_accelerated(x.size());
+            for (std::size_t i = 0; i < x.size(); i++) {
+                // Sum each distance alone, so that each needs its own modes
+                SetResidueSeriesOptions(ResidueSeriesOptions());
+                ResidueSeriesModes modes;
+                Initialize(constants, modes);
+                ResidueSeriesFields(modes, 1, &x[i], &E_gw[i]);
+
+                SetResidueSeriesOptions(options);
+                ResidueSeriesModes accelerated;
+                Initialize(constants, accelerated);
+                ResidueSeriesFields(accelerated, 1, &x[i], &E_accelerated[i]);
+
+                EXPECT_NEAR(
+                    20.0 * std::log10(E_accelerated[i] / E_gw[i]), 0.0, 0.02
+                ) << "f__mhz = "
+                  << f__mhz[c] << ", sigma = " << sigma[c] << ", x = " << x[i];
+                if (i == 0) {
+                    EXPECT_LT(accelerated.W.size(), modes.W.size());
+                }
+            }
+        }
+    }
+}
+
+/** Predictions with the accelerated series stay within 0.02 dB */
+TEST_F(TestResidueSeries, AcceleratedSeriesOption) {
+    const double f__mhz[] = {0.01, 1.0, 30.0};
+    const Polarization pol = Polarization::VERTICAL;
+    std::vector<Result> expected;
+    for (const double f : f__mhz) {
+        Result result;
+        LFMF_CPP(0, 10, f, 1000, 301, 400, 80, 5, pol, result);
+        expected.push_back(result);
+    }
+
+    ResidueSeriesOptions options;
+    options.accelerate = true;
+    SetResidueSeriesOptions(options);
+    for (std::size_t i = 0; i < 3; i++) {
+        Result result;
+        EXPECT_EQ(
+            LFMF_CPP(0, 10, f__mhz[i], 1000, 301, 400, 80, 5, pol, result),
+            SUCCESS
+        );
+        EXPECT_EQ(result.method, SolutionMethod::RESIDUE_SERIES);
+        EXPECT_NEAR(result.E_dBuVm, expected[i].E_dBuVm, 0.02)
+            << "f__mhz = " << f__mhz[i];
+    }
+}
@@ -0,0 +1,146 @@
+/** @file TestRootCache.cpp
+ * Unit tests for the residue series root cache.
+ */
+
+#include "TestUtils.h"
+
+#include <complex>  // for std::complex
+#include <thread>   // for std::thread
+#include <vector>   // for std::vector
+
+/** Test fixture leaves the root cache disabled and empty after each test */
+class TestRootCache: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            ClearRootCache();
+        }
+
+        void TearDown() override {
+            SetRootCacheCapacity(0);
+            ClearRootCache();
+        }
+
+        /** Evaluate a residue series path at the given frequency */
+        Result Evaluate(const double f__mhz) {
+            Result result;
+            const ReturnCode rtn = LFMF_CPP(
+                0, 0, f__mhz, 1000, 301, 500, 15, 0.005, pol, result
+            );
+            EXPECT_EQ(rtn, SUCCESS);
+            EXPECT_EQ(result.method, SolutionMethod::RESIDUE_SERIES);
+            return result;
+        }
+
+        const Polarization pol = Polarization::VERTICAL;
+        RootCacheStats stats;
+};
+
+/** The cache is disabled by default and records nothing */
+TEST_F(TestRootCache, DisabledByDefault) {
+    Evaluate(0.5);
+    Evaluate(0.5);
+    GetRootCacheStats(stats);
+    EXPECT_EQ(stats.capacity, 0u);
+    EXPECT_EQ(stats.size, 0u);
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+}
+
+/** Cached roots give the same result as roots found by WiRoot() */
+TEST_F(TestRootCache, HitGivesSameResult) {
+    const Result uncached = Evaluate(0.5);
+
+    SetRootCacheCapacity(64);
+    const Result first = Evaluate(0.5);
+    const Result second = Evaluate(0.5);
+
+    GetRootCacheStats(stats);
+    EXPECT_EQ(stats.size, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+
+    EXPECT_DOUBLE_EQ(first.E_dBuVm, uncached.E_dBuVm);
+    EXPECT_DOUBLE_EQ(second.E_dBuVm, uncached.E_dBuVm);
+    EXPECT_DOUBLE_EQ(second.A_btl__db, uncached.A_btl__db);
+    EXPECT_DOUBLE_EQ(second.P_rx__dbm, uncached.P_rx__dbm);
+}
+
+/** Cached roots are found by the roots function used to add them */
+TEST_F(TestRootCache, KeyIncludesKindAndScaling) {
+    SetRootCacheCapacity(64);
+    const std::complex<double> q(1.5, -2.0);
+    const std::vector<std::complex<double>> T_in = {{1, -1}, {2, -3}};
+    std::vector<std::complex<double>> T, W1;
+
+    StoreRootCache(q, AiryKind::WONE, AiryScaling::WAIT, T_in, T_in);
+    EXPECT_TRUE(LookupRootCache(q, AiryKind::WONE, AiryScaling::WAIT, T, W1));
+    EXPECT_EQ(T, T_in);
+    EXPECT_FALSE(LookupRootCache(q, AiryKind::WTWO, AiryScaling::WAIT, T, W1));
+    EXPECT_FALSE(
+        LookupRootCache(q, AiryKind::WONE, AiryScaling::HUFFORD, T, W1)
+    );
+    EXPECT_FALSE(LookupRootCache(
+        q * 1.000001, AiryKind::WONE, AiryScaling::WAIT, T, W1
+    ));
+}
+
+/** The least recently used entries are evicted when the cache is full */
+TEST_F(TestRootCache, EvictsToCapacity) {
+    SetRootCacheCapacity(1);
+    GetRootCacheStats(stats);
+    const std::size_t capacity = stats.capacity;
+
+    for (int i = 0; i < 100; i++)
+        Evaluate(0.2 + 0.01 * i);
+
+    GetRootCacheStats(stats);
+    EXPECT_EQ(stats.misses, 100u);
+    EXPECT_GT(stats.evictions, 0u);
+    EXPECT_LE(stats.size, 16u);
+    EXPECT_EQ(stats.size + stats.evictions, 100u);
+    EXPECT_EQ(capacity, 1u);
+
+    SetRootCacheCapacity(0);
+    GetRootCacheStats(stats);
+    EXPECT_EQ(stats.size, 0u);
+}
+
+/** Concurrent evaluations share the cache and give consistent results */
+TEST_F(TestRootCache, ConcurrentUse) {
+    const std::vector<double> f__mhz = {0.3, 0.5, 0.7, 0.9};
+    std::vector<Result> expected;
+    for (const double f : f__mhz)
+        expected.push_back(Evaluate(f));
+
+    SetRootCacheCapacity(64);
+    std::vector<std::vector<Result>> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); t++) {
+        threads.emplace_back([&, t]() {
+            for (int rep = 0; rep < 10; rep++) {
+                for (const double f : f__mhz) {
+                    Result result;
+                    LFMF_CPP(0, 0, f, 1000, 301, 500, 15, 0.005, pol, result);
+                    results[t].push_back(result);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &thread_results : results) {
+        ASSERT_EQ(thread_results.size(), 10 * f__mhz.size());
+        for (std::size_t i = 0; i < thread_results.size(); i++) {
+            EXPECT_DOUBLE_EQ(
+                thread_results[i].E_dBuVm,
+                expected[i % f__mhz.size()].E_dBuVm
+            );
+        }
+    }
+
+    GetRootCacheStats(stats);
+    EXPECT_EQ(stats.size, f__mhz.size());
+    EXPECT_EQ(stats.hits + stats.misses, 4u * 10u * f__mhz.size());
+    EXPECT_GE(stats.misses, f__mhz.size());
+}
@@ -4,7 +4,7 @@
 #include "TestUtils.h"
 
 #include <fstream>  // for std::ifstream
-#include <sstream>  // for std::istringstream
+#include <sstream>  // for std::istringstream, std::ostringstream
 #include <string>   // for std::string, std::getline
 #include <vector>   // for std::vector
 
@@ -40,6 +40,65 @@ std::string GetDataDirectory() {
     return dataDir;
 }
 
+/*******************************************************************************
+ * Compare one point of a sweep to an independent `LFMF_CPP()` call with the
+ * same inputs.
+ *
+ * The return codes must be equal, and for `SUCCESS` so must the results. The
+ * inputs are reported with any failure.
+ *
+ * @param[in] inputs      Inputs of the point
+ * @param[in] rtn         Return code of the point
+ * @param[in] result      Result of the point
+ * @param[in] tol         Absolute tolerance of the results; if 0, they must
+ *                        agree as by `EXPECT_DOUBLE_EQ()`
+ * @param[in] has_method  False if the point does not report a solution method
+ ******************************************************************************/
+void ExpectMatchesLFMF(
+    const LFMFInputs &inputs,
+    const ReturnCode rtn,
+    const Result &result,
+    const double tol,
+    const bool has_method
+) {
+    std::ostringstream trace;
+    trace << "h_tx__meter = " << inputs.h_tx__meter
+          << ", h_rx__meter = " << inputs.h_rx__meter
+          << ", f__mhz = " << inputs.f__mhz << ", d__km = " << inputs.d__km
+          << ", epsilon = " << inputs.epsilon << ", sigma = " << inputs.sigma;
+    SCOPED_TRACE(trace.str());
+
+    Result expected;
+    const ReturnCode expected_rtn = LFMF_CPP(
+        inputs.h_tx__meter,
+        inputs.h_rx__meter,
+        inputs.f__mhz,
+        inputs.P_tx__watt,
+        inputs.N_s,
+        inputs.d__km,
+        inputs.epsilon,
+        inputs.sigma,
+        inputs.pol,
+        expected
+    );
+    EXPECT_EQ(rtn, expected_rtn);
+    if (rtn != SUCCESS || expected_rtn != SUCCESS)
+        return;
+
+    if (tol == 0.0) {
+        EXPECT_DOUBLE_EQ(result.A_btl__db, expected.A_btl__db);
+        EXPECT_DOUBLE_EQ(result.E_dBuVm, expected.E_dBuVm);
+        EXPECT_DOUBLE_EQ(result.P_rx__dbm, expected.P_rx__dbm);
+    } else {
+        EXPECT_NEAR(result.A_btl__db, expected.A_btl__db, tol);
+        EXPECT_NEAR(result.E_dBuVm, expected.E_dBuVm, tol);
+        EXPECT_NEAR(result.P_rx__dbm, expected.P_rx__dbm, tol);
+    }
+    if (has_method) {
+        EXPECT_EQ(result.method, expected.method);
+    }
+}
+
 /*******************************************************************************
  * Loads test data from a CSV file
  *
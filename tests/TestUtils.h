@@ -38,8 +38,32 @@ struct LFMFTestData {
         double P_rx__dbm;      /**< Expected result received power, in dBm */
         SolutionMethod method; /**< Expected result solution method enum value */
 };
+
+/** Inputs of one `LFMF_CPP()` call, to which a point of a sweep is compared */
+struct LFMFInputs {
+        double h_tx__meter;    /**< Height of the transmitter, in meters */
+        double h_rx__meter;    /**< Height of the receiver, in meters */
+        double f__mhz;         /**< Frequency, in MHz */
+        double P_tx__watt;     /**< Transmitter power, in watts */
+        double N_s;            /**< Surface refractivity, in N-Units */
+        double d__km;          /**< Path distance, in km */
+        double epsilon;        /**< Relative permittivity */
+        double sigma;          /**< Conductivity, in siemens per meter */
+        Polarization pol;      /**< Polarization enum value */
+};
 // clang-format on
 
+// Transmitter power and surface refractivity used by the sweep tests
+constexpr double SWEEP_P_TX__WATT = 1000;
+constexpr double SWEEP_N_S = 301;
+
+void ExpectMatchesLFMF(
+    const LFMFInputs &inputs,
+    const ReturnCode rtn,
+    const Result &result,
+    const double tol = 0.0,
+    const bool has_method = true
+);
 std::vector<LFMFTestData> ReadLFMFTestData(const std::string &filename);
 std::vector<LFMFTestData> ReadLFMFValidationData(const std::string &filename);
 void AppendDirectorySep(std::string &str);
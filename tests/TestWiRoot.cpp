@@ -92,6 +92,241 @@ TEST_F(TestWiRoot, LargeQLargeI) {
     EXPECT_NEAR(root.imag(), 11.742393555292688, ABSTOL_DBL);
 }
 
+/** The status-returning variant matches `WiRoot()` */
+TEST_F(TestWiRoot, TryWiRootMatchesWiRoot) {
+    std::complex<double> try_DWi, try_Wi, try_root;
+    int iterations;
+    for (i = 1; i <= 12; i++) {
+        root = WiRoot(i, DWi, q, Wi, kind, scaling);
+        EXPECT_EQ(
+            TryWiRoot(i, try_DWi, q, try_Wi, kind, scaling, try_root, iterations),
+            SUCCESS
+        );
+        EXPECT_EQ(try_root, root) << "i = " << i;
+        EXPECT_EQ(try_Wi, Wi) << "i = " << i;
+        EXPECT_EQ(try_DWi, DWi) << "i = " << i;
+        EXPECT_GT(iterations, 0);
+    }
+}
+
+/** Halley's method finds the roots of Newton's method with fewer iterations */
+TEST_F(TestWiRoot, HalleyMatchesNewton) {
+    // Each iteration evaluates Wi and Wi' once, by `TryAiryPair()`, in either
+    // method, so iterations count the Airy evaluations of the root search
+    long newton_iterations = 0, halley_iterations = 0;
+    for (const std::complex<double> &q_n :
+         {std::complex<double>(1.0, 1.0), std::complex<double>(5.0, 5.0)}) {
+        for (const AiryKind k : {AiryKind::WONE, AiryKind::WTWO}) {
+            for (const AiryScaling s :
+                 {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+                for (i = 1; i <= 12; i++) {
+                    std::complex<double> newton_root, halley_root;
+                    int newton_n, halley_n;
+                    ASSERT_EQ(
+                        TryWiRoot(i, DWi, q_n, Wi, k, s, newton_root, newton_n),
+                        SUCCESS
+                    );
+                    ASSERT_EQ(
+                        TryWiRoot(
+                            i,
+                            DWi,
+                            q_n,
+                            Wi,
+                            k,
+                            s,
+                            halley_root,
+                            halley_n,
+                            WiRootIteration::HALLEY
+                        ),
+                        SUCCESS
+                    );
+                    EXPECT_NEAR(
+                        std::abs(halley_root - newton_root),
+                        0.0,
+                        0.5e-6 * std::abs(newton_root)
+                    ) << "q = "
+                      << q_n << ", i = " << i;
+                    EXPECT_LE(halley_n, newton_n);
+                    newton_iterations += newton_n;
+                    halley_iterations += halley_n;
+                }
+            }
+        }
+    }
+    RecordProperty("NewtonAiryPairs", static_cast<int>(newton_iterations));
+    RecordProperty("HalleyAiryPairs", static_cast<int>(halley_iterations));
+    EXPECT_LT(halley_iterations, newton_iterations);
+}
+
+/** Roots extrapolated from the two before them refine to the same roots */
+TEST_F(TestWiRoot, ExtrapolateWiRootMatchesWiRoot) {
+    long start_iterations = 0, extrapolated_iterations = 0;
+    for (const std::complex<double> &q_n :
+         {std::complex<double>(1.0, 1.0), std::complex<double>(5.0, 5.0)}) {
+        for (const AiryScaling s : {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+            std::complex<double> roots[200];
+            for (i = 1; i <= 200; i++) {
+                int iterations;
+                ASSERT_EQ(
+                    TryWiRoot(
+                        i, DWi, q_n, Wi, kind, s, roots[i - 1], iterations
+                    ),
+                    SUCCESS
+                );
+                if (i < 3)
+                    continue;
+                start_iterations += iterations;
+
+                root = ExtrapolateWiRoot(
+                    i, roots[i - 2], roots[i - 3], q_n, kind, s
+                );
+                ASSERT_EQ(
+                    TryRefineWiRoot(root, DWi, q_n, Wi, kind, s, iterations),
+                    SUCCESS
+                );
+                EXPECT_NEAR(
+                    std::abs(root - roots[i - 1]),
+                    0.0,
+                    0.5e-6 * std::abs(roots[i - 1])
+                ) << "q = "
+                  << q_n << ", i = " << i;
+                extrapolated_iterations += iterations;
+            }
+        }
+    }
+    RecordProperty("StartIterations", static_cast<int>(start_iterations));
+    RecordProperty(
+        "ExtrapolatedIterations", static_cast<int>(extrapolated_iterations)
+    );
+    EXPECT_LT(extrapolated_iterations, start_iterations);
+}
+
+/** Blocks of roots found together match the roots found one at a time */
+TEST_F(TestWiRoot, WiRootBlockMatchesWiRoot) {
+    constexpr std::size_t n = 40, block = 8;
+    long single_iterations = 0, block_iterations = 0;
+    for (const std::complex<double> &q_n :
+         {std::complex<double>(1.0, 1.0), std::complex<double>(5.0, 5.0)}) {
+        for (const AiryScaling s : {AiryScaling::HUFFORD, AiryScaling::WAIT}) {
+            std::complex<double> roots[n];
+            for (std::size_t b = 0; b < n; b += block) {
+                long iterations;
+                ASSERT_EQ(
+                    TryWiRootBlock(
+                        static_cast<int>(b) + 1,
+                        block,
+                        q_n,
+                        kind,
+                        s,
+                        &roots[b],
+                        iterations,
+                        b >= 2 ? &roots[b - 2] : nullptr
+                    ),
+                    SUCCESS
+                );
+                block_iterations += iterations;
+            }
+            for (i = 1; i <= static_cast<int>(n); i++) {
+                int iterations;
+                ASSERT_EQ(
+                    TryWiRoot(i, DWi, q_n, Wi, kind, s, root, iterations),
+                    SUCCESS
+                );
+                single_iterations += iterations;
+                EXPECT_NEAR(
+                    std::abs(roots[i - 1] - root), 0.0, 0.5e-6 * std::abs(root)
+                ) << "q = "
+                  << q_n << ", i = " << i;
+            }
+        }
+    }
+    RecordProperty("SingleAiryPairs", static_cast<int>(single_iterations));
+    RecordProperty("BlockAiryPairs", static_cast<int>(block_iterations));
+    EXPECT_LT(block_iterations, single_iterations);
+}
+
+/** Blocks find closely spaced roots, and roots with no room between others */
+TEST_F(TestWiRoot, WiRootBlockCloseRoots) {
+    // For the first q, the second and third roots are about a fifth of the
+    // usual spacing apart. For the second, the first root has left the row
+    // of roots, and `WiRoot()` finds the second root in its place.
+    const std::complex<double> qs[] = {{1.96, -0.86}, {1.35, 0.66}};
+    for (const std::complex<double> &q_n : qs) {
+        constexpr std::size_t n = 8;
+        std::complex<double> roots[n];
+        long iterations;
+        ASSERT_EQ(
+            TryWiRootBlock(
+                1, n, q_n, kind, AiryScaling::WAIT, roots, iterations
+            ),
+            SUCCESS
+        );
+        for (i = 1; i <= static_cast<int>(n); i++) {
+            int single_iterations;
+            ASSERT_EQ(
+                TryWiRoot(
+                    i,
+                    DWi,
+                    q_n,
+                    Wi,
+                    kind,
+                    AiryScaling::WAIT,
+                    root,
+                    single_iterations
+                ),
+                SUCCESS
+            );
+            EXPECT_NEAR(
+                std::abs(roots[i - 1] - root), 0.0, 0.5e-6 * std::abs(root)
+            ) << "q = "
+              << q_n << ", i = " << i;
+        }
+    }
+}
+
+/** The status-returning variant reports invalid inputs by return code */
+TEST_F(TestWiRoot, TryWiRootInvalidInputs) {
+    int iterations;
+    EXPECT_EQ(
+        TryWiRoot(0, DWi, q, Wi, kind, scaling, root, iterations),
+        ERROR__WIROOT_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryWiRoot(i, DWi, q, Wi, AiryKind::AIRY, scaling, root, iterations),
+        ERROR__WIROOT_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryWiRoot(i, DWi, q, Wi, kind, AiryScaling::NONE, root, iterations),
+        ERROR__WIROOT_ARGUMENT
+    );
+    long block_iterations;
+    EXPECT_EQ(
+        TryWiRootBlock(0, 1, q, kind, scaling, &root, block_iterations),
+        ERROR__WIROOT_ARGUMENT
+    );
+    EXPECT_EQ(
+        TryWiRootBlock(
+            i, 1, q, AiryKind::AIRY, scaling, &root, block_iterations
+        ),
+        ERROR__WIROOT_ARGUMENT
+    );
+}
+
+/** A failed root search stops the residue series from adding roots */
+TEST_F(TestWiRoot, ResidueSeriesKeepsFailure) {
+    ResidueSeriesRoots roots;
+    roots.q = q;
+    AddResidueSeriesRoot(roots);
+    ASSERT_EQ(roots.status, SUCCESS);
+    ASSERT_EQ(roots.T.size(), 1u);
+
+    roots.status = ERROR__WIROOT_CONVERGENCE;
+    AddResidueSeriesRoot(roots);
+    EXPECT_EQ(roots.T.size(), 1u);
+    EXPECT_EQ(roots.W1.size(), 1u);
+}
+
+#ifndef LFMF_NO_EXCEPTIONS
 /** WiRoot should throw an exception when `i` is <= 0 */
 TEST_F(TestWiRoot, InvalidRootSelected) {
     i = -1;
@@ -140,4 +375,5 @@ TEST_F(TestWiRoot, AiryKindDWONE) {
     EXPECT_THROW(
         WiRoot(i, DWi, q, Wi, AiryKind::DWONE, scaling), std::invalid_argument
     );
-}
\ No newline at end of file
+}
+#endif
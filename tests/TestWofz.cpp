@@ -0,0 +1,42 @@
+/** @file TestWofz.cpp
+ * Unit tests for the batch Faddeeva function.
+ */
+
+#include "TestUtils.h"
+
+#include <cmath>    // for std::abs
+#include <complex>  // for std::complex
+#include <vector>   // for std::vector
+
+/** The batch matches the scalar routine in every region and quadrant */
+TEST(TestWofz, BatchMatchesScalar) {
+    // Arguments from the power series, Taylor expansion, and continued
+    // fraction regions, in all four quadrants and on the axes, interleaved so
+    // that every block mixes regions before grouping
+    std::vector<std::complex<double>> z;
+    for (const double re : {0.0, 0.3, 1.1, 2.5, 4.0, 7.0, 30.0}) {
+        for (const double im : {0.0, 0.2, 0.9, 2.0, 3.5, 9.0}) {
+            z.emplace_back(re, im);
+            z.emplace_back(-re, im);
+            z.emplace_back(re, -im);
+            z.emplace_back(-re, -im);
+        }
+    }
+    z.emplace_back(1e200, 1.0);  // Overflow of QRHO
+    z.emplace_back(-6.0, -25.0);  // Overflow of exp(-z^2)
+
+    std::vector<std::complex<double>> w(z.size());
+    wofz(z.size(), z.data(), w.data());
+
+    for (std::size_t i = 0; i < z.size(); i++) {
+        const std::complex<double> expected = wofz(z[i]);
+        const double tol = 1e-13 * std::abs(expected);
+        EXPECT_NEAR(w[i].real(), expected.real(), tol) << "z = " << z[i];
+        EXPECT_NEAR(w[i].imag(), expected.imag(), tol) << "z = " << z[i];
+    }
+}
+
+/** An empty batch does nothing */
+TEST(TestWofz, EmptyBatch) {
+    wofz(0, nullptr, nullptr);
+}
@@ -0,0 +1,367 @@
+/** @file GenerateAiryTables.cpp
+ * Generates `src/AiryTables.h`, the tables of piecewise polynomial
+ * approximations of Airy functions used by the library.
+ *
+ * The tables are found from `TryAiryPair()` of the library itself, which
+ * does not depend on them, and the program is run as:
+ *
+ *     GenerateAiryTables src/AiryTables.h
+ *
+ * Since the library includes the tables, a change to their layout is made by
+ * building this program against the library as it was before the change.
+ */
+#include "LFMF.h"
+
+#include <cmath>    // for std::abs, std::cos, std::pow, std::sin, std::sqrt
+#include <complex>  // for std::complex
+#include <cstdio>   // for std::fclose, std::fopen, std::fprintf, FILE
+#include <vector>   // for std::vector
+
+using namespace ITS::Propagation::LFMF;
+
+/** Side of the square cells of the tables */
+constexpr double AIRY_TABLE_STEP = 0.25;
+
+/** Least real part of the rotated argument covered by the table */
+constexpr double AIRY_TABLE_REAL_MIN = -32.0;
+
+/** Number of cells along the real and imaginary axes of the table */
+constexpr int AIRY_TABLE_REAL_CELLS = 160;  // Up to a real part of 8
+constexpr int AIRY_TABLE_IMAG_CELLS = 16;   // Up to an imaginary part of 4
+
+/** Number of Taylor coefficients fitted for each cell */
+constexpr int AIRY_TABLE_TERMS = 21;
+
+/** Relative truncation error of each `AiryAccuracy` tier */
+constexpr double AIRY_ACCURACY_TOL[] = {1.0e-4, 1.0e-8, 1.0e-13};
+
+/** Number of `AiryAccuracy` tiers */
+constexpr int AIRY_ACCURACY_TIERS = 3;
+
+/** Least real part of the rotated argument covered by the residue table */
+constexpr double RESIDUE_AIRY_REAL_MIN = -32.0;
+
+/** Least imaginary part of the rotated argument covered by the residue table */
+constexpr double RESIDUE_AIRY_IMAG_MIN = -2.0;
+
+/** Number of cells along the real and imaginary axes of the residue table */
+constexpr int RESIDUE_AIRY_REAL_CELLS = 136;  // Up to a real part of 2
+constexpr int RESIDUE_AIRY_IMAG_CELLS = 16;   // Up to an imaginary part of 2
+
+/** Polynomial approximation of Ai(Z) over one cell */
+struct AiryFit {
+        std::complex<double> center;
+        std::complex<double> a[AIRY_TABLE_TERMS];  // Taylor coefficients
+        int degree[AIRY_ACCURACY_TIERS];  // Degree used by each tier; -1 if
+                                          // the cell is not usable
+};
+
+/*******************************************************************************
+ * Approximate Ai(Z) over one cell of a table by its Taylor polynomial about
+ * the cell center.
+ *
+ * Since Airy functions are entire, the Taylor polynomial is within a small
+ * factor of the best polynomial approximation on the disk circumscribing the
+ * cell: the analogue, for a region of the complex plane, of a Chebyshev
+ * approximation on an interval.
+ *
+ * The function and its derivative at the center are found by `TryAiryPair()`,
+ * and the remaining coefficients follow from the Airy equation f'' = Z f. The
+ * degree used by each tier is the least for which the remaining terms of the
+ * series, bounded on the circumscribing disk, are below the tolerance of the
+ * tier relative to the bound of the whole series.
+ *
+ * @param[in,out] fit  Fit with its center set; on return, its coefficients
+ *                     and the degree used by each tier
+ ******************************************************************************/
+void FitAiryCell(AiryFit &fit) {
+    const double r = AIRY_TABLE_STEP * std::sqrt(0.5);  // Circumradius
+
+    for (int t = 0; t < AIRY_ACCURACY_TIERS; t++)
+        fit.degree[t] = -1;
+
+    const ReturnCode rtn = TryAiryPair(
+        fit.center, AiryKind::AIRY, AiryScaling::NONE, fit.a[0], fit.a[1]
+    );
+    if (rtn != SUCCESS)
+        return;  // Left for `Airy()` to report
+
+    // With Z = center + w, the Airy equation gives
+    // k (k - 1) a[k] = center a[k - 2] + a[k - 3]
+    for (int k = 2; k < AIRY_TABLE_TERMS; k++) {
+        fit.a[k] = fit.center * fit.a[k - 2];
+        if (k >= 3)
+            fit.a[k] += fit.a[k - 3];
+        fit.a[k] /= static_cast<double>(k * (k - 1));
+    }
+
+    // Bounds of each term of the function and the derivative on the
+    // circumscribing disk, and of the series
+    double term[AIRY_TABLE_TERMS], dterm[AIRY_TABLE_TERMS];
+    double sum = 0.0, dsum = 0.0;
+    for (int k = 0; k < AIRY_TABLE_TERMS; k++) {
+        term[k] = std::abs(fit.a[k]) * std::pow(r, k);
+        dterm[k] = k * std::abs(fit.a[k]) * std::pow(r, k - 1);
+        sum += term[k];
+        dsum += dterm[k];
+    }
+
+    for (int t = 0; t < AIRY_ACCURACY_TIERS; t++) {
+        const double tol = AIRY_ACCURACY_TOL[t];
+        // The last coefficient bounds the terms which are not kept
+        if (term[AIRY_TABLE_TERMS - 1] > tol * sum
+            || dterm[AIRY_TABLE_TERMS - 1] > tol * dsum)
+            continue;
+        double tail = 0.0, dtail = 0.0;
+        int n = AIRY_TABLE_TERMS - 1;
+        while (n > 0 && tail + term[n] <= tol * sum
+               && dtail + dterm[n] <= tol * dsum) {
+            tail += term[n];
+            dtail += dterm[n];
+            n--;
+        }
+        fit.degree[t] = n;
+    }
+}
+
+/*******************************************************************************
+ * Write a complex number as an initializer which reads back exactly.
+ *
+ * @param[in] fp  File to write to
+ * @param[in] a   The number
+ ******************************************************************************/
+void WriteComplex(FILE *fp, const std::complex<double> a) {
+    std::fprintf(fp, "    {%.16e, %.16e},\n", a.real(), a.imag());
+}
+
+/*******************************************************************************
+ * Write the table of `FastAiry()`.
+ *
+ * The cells cover the rotated and reflected arguments of the residue series,
+ * with a margin. The coefficients of each cell are kept up to the degree of
+ * its most accurate usable tier, and the coefficients of all cells are stored
+ * together, lowest degree first.
+ *
+ * @param[in] fp    File to write to
+ * @param[in] fits  Fits of the cells, with the imaginary index varying slowest
+ ******************************************************************************/
+void WriteFastAiryTable(FILE *fp, const std::vector<AiryFit> &fits) {
+    std::fprintf(
+        fp,
+        "/** Side of the square cells of the tables */\n"
+        "constexpr double AIRY_TABLE_STEP = %.2f;\n\n"
+        "/** Least real part of the rotated argument covered by the table of\n"
+        " *  `FastAiry()` */\n"
+        "constexpr double AIRY_TABLE_REAL_MIN = %.1f;\n\n"
+        "/** Number of cells along the real and imaginary axes of the table of"
+        "\n *  `FastAiry()` */\n"
+        "constexpr int AIRY_TABLE_REAL_CELLS = %d;\n"
+        "constexpr int AIRY_TABLE_IMAG_CELLS = %d;\n\n"
+        "/** Number of `AiryAccuracy` tiers */\n"
+        "constexpr int AIRY_ACCURACY_TIERS = %d;\n\n",
+        AIRY_TABLE_STEP,
+        AIRY_TABLE_REAL_MIN,
+        AIRY_TABLE_REAL_CELLS,
+        AIRY_TABLE_IMAG_CELLS,
+        AIRY_ACCURACY_TIERS
+    );
+
+    std::fprintf(
+        fp,
+        "/** One cell of the table of `FastAiry()`, a polynomial approximation "
+        "of\n *  Ai(Z) about the center of the cell */\n"
+        "struct AiryTableCell {\n"
+        "        int degree[AIRY_ACCURACY_TIERS];  // Degree used by each "
+        "tier; -1 if\n"
+        "                                          // the cell is not usable\n"
+        "        int offset;  // Index of the coefficient of degree 0\n"
+        "};\n\n"
+        "/** Cells of the table of `FastAiry()`, with the imaginary index "
+        "varying\n *  slowest */\n"
+        "constexpr AiryTableCell AIRY_TABLE_CELLS[] = {\n"
+    );
+    int offset = 0;
+    for (const AiryFit &fit : fits) {
+        std::fprintf(
+            fp,
+            "    {{%d, %d, %d}, %d},\n",
+            fit.degree[0],
+            fit.degree[1],
+            fit.degree[2],
+            offset
+        );
+        int n = -1;
+        for (int t = 0; t < AIRY_ACCURACY_TIERS; t++)
+            n = fit.degree[t] > n ? fit.degree[t] : n;
+        offset += n + 1;
+    }
+    std::fprintf(fp, "};\n\n");
+
+    std::fprintf(
+        fp,
+        "/** Taylor coefficients of the cells of the table of `FastAiry()` */\n"
+        "constexpr std::complex<double> AIRY_TABLE_COEFFICIENTS[] = {\n"
+    );
+    for (const AiryFit &fit : fits) {
+        int n = -1;
+        for (int t = 0; t < AIRY_ACCURACY_TIERS; t++)
+            n = fit.degree[t] > n ? fit.degree[t] : n;
+        for (int k = 0; k <= n; k++)
+            WriteComplex(fp, fit.a[k]);
+    }
+    std::fprintf(fp, "};\n");
+}
+
+/*******************************************************************************
+ * Write the table of Wait's w1 over the arguments of the residue series, used
+ * by `ResidueSeriesAiry()`.
+ *
+ * Cells are those of the table of `FastAiry()`, at the `STANDARD` tier. They
+ * cover both sides of the real axis of the rotated argument, so that no
+ * reflection is needed, and the scale factor of Wait's w1 is folded into the
+ * coefficients. The coefficients of all cells are stored together, highest
+ * degree first, in the order in which Horner's method reads them.
+ *
+ * @param[in] fp    File to write to
+ * @param[in] fits  Fits of the cells of the table of `FastAiry()`
+ ******************************************************************************/
+void WriteResidueAiryTable(FILE *fp, const std::vector<AiryFit> &fits) {
+    // Rotation of the argument and scale factor of Wait's w1, as in `Airy()`
+    const std::complex<double> rotation(
+        std::cos(-2.0 * PI / 3.0), std::sin(-2.0 * PI / 3.0)
+    );
+    const std::complex<double> scale(std::sqrt(3.0 * PI), -1.0 * std::sqrt(PI));
+    const int tier = static_cast<int>(AiryAccuracy::STANDARD);
+
+    std::fprintf(
+        fp,
+        "\n/** Least real part of the rotated argument covered by the residue "
+        "table */\n"
+        "constexpr double RESIDUE_AIRY_REAL_MIN = %.1f;\n\n"
+        "/** Least imaginary part of the rotated argument covered by the "
+        "residue\n *  table */\n"
+        "constexpr double RESIDUE_AIRY_IMAG_MIN = %.1f;\n\n"
+        "/** Number of cells along the real and imaginary axes of the residue "
+        "table */\n"
+        "constexpr int RESIDUE_AIRY_REAL_CELLS = %d;\n"
+        "constexpr int RESIDUE_AIRY_IMAG_CELLS = %d;\n\n"
+        "/** Rotation of the argument of Wait's w1 */\n"
+        "constexpr std::complex<double> RESIDUE_AIRY_ROTATION = "
+        "{\n    %.16e, %.16e\n};\n\n",
+        RESIDUE_AIRY_REAL_MIN,
+        RESIDUE_AIRY_IMAG_MIN,
+        RESIDUE_AIRY_REAL_CELLS,
+        RESIDUE_AIRY_IMAG_CELLS,
+        rotation.real(),
+        rotation.imag()
+    );
+
+    std::fprintf(
+        fp,
+        "/** One cell of the table of `ResidueSeriesAiry()`, a polynomial\n"
+        " *  approximation of Wait's w1 about the center of the cell */\n"
+        "struct ResidueAiryCell {\n"
+        "        int degree;  // Degree of the polynomial; -1 if not usable\n"
+        "        int offset;  // Index of the coefficient of highest degree\n"
+        "};\n\n"
+        "/** Cells of the table of `ResidueSeriesAiry()`, with the imaginary "
+        "index\n *  varying slowest */\n"
+        "constexpr ResidueAiryCell RESIDUE_AIRY_CELLS[] = {\n"
+    );
+    // Since Ai(conj(Z)) = conj(Ai(Z)), the cells above the real axis are
+    // those of the table of `FastAiry()`, and those below it are their
+    // reflections
+    const int half = RESIDUE_AIRY_IMAG_CELLS / 2;
+    const int l_first = static_cast<int>(
+        (RESIDUE_AIRY_REAL_MIN - AIRY_TABLE_REAL_MIN) / AIRY_TABLE_STEP
+    );
+    std::vector<std::complex<double>> coefficients;
+    for (int m = 0; m < RESIDUE_AIRY_IMAG_CELLS; m++) {
+        const bool reflection = m < half;
+        const int fit_m = reflection ? half - 1 - m : m - half;
+        for (int l = 0; l < RESIDUE_AIRY_REAL_CELLS; l++) {
+            const AiryFit &fit
+                = fits[fit_m * AIRY_TABLE_REAL_CELLS + l_first + l];
+            const int degree = fit.degree[tier];
+            std::fprintf(
+                fp,
+                "    {%d, %d},\n",
+                degree,
+                static_cast<int>(coefficients.size())
+            );
+            for (int k = degree; k >= 0; k--) {
+                coefficients.push_back(
+                    scale * (reflection ? std::conj(fit.a[k]) : fit.a[k])
+                );
+            }
+        }
+    }
+    std::fprintf(fp, "};\n\n");
+
+    std::fprintf(
+        fp,
+        "/** Coefficients of the cells of the table of `ResidueSeriesAiry()` "
+        "*/\n"
+        "constexpr std::complex<double> RESIDUE_AIRY_COEFFICIENTS[] = {\n"
+    );
+    for (const std::complex<double> &a : coefficients)
+        WriteComplex(fp, a);
+    std::fprintf(fp, "};\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: GenerateAiryTables <output header>\n");
+        return 1;
+    }
+
+    std::vector<AiryFit> fits(AIRY_TABLE_REAL_CELLS * AIRY_TABLE_IMAG_CELLS);
+    for (int m = 0; m < AIRY_TABLE_IMAG_CELLS; m++) {
+        for (int l = 0; l < AIRY_TABLE_REAL_CELLS; l++) {
+            AiryFit &fit = fits[m * AIRY_TABLE_REAL_CELLS + l];
+            fit.center = std::complex<double>(
+                AIRY_TABLE_REAL_MIN + (l + 0.5) * AIRY_TABLE_STEP,
+                (m + 0.5) * AIRY_TABLE_STEP
+            );
+            FitAiryCell(fit);
+        }
+    }
+
+    FILE *fp = std::fopen(argv[1], "w");
+    if (fp == nullptr) {
+        std::fprintf(stderr, "Unable to open %s\n", argv[1]);
+        return 1;
+    }
+    std::fprintf(
+        fp,
+        "/** @file AiryTables.h\n"
+        " * Tables of piecewise polynomial approximations of Airy functions, "
+        "used by\n"
+        " * `FastAiry()` and `ResidueSeriesAiry()`.\n"
+        " *\n"
+        " * This file is generated by `tools/GenerateAiryTables.cpp` and is "
+        "not to be\n"
+        " * edited by hand.\n"
+        " */\n"
+        "#pragma once\n\n"
+        "#include <complex>  // for std::complex\n\n"
+        "namespace ITS {\n"
+        "namespace Propagation {\n"
+        "namespace LFMF {\n"
+        "namespace {\n\n"
+    );
+    WriteFastAiryTable(fp, fits);
+    WriteResidueAiryTable(fp, fits);
+    std::fprintf(
+        fp,
+        "\n}  // namespace\n"
+        "}  // namespace LFMF\n"
+        "}  // namespace Propagation\n"
+        "}  // namespace ITS\n"
+    );
+    if (std::fclose(fp) != 0) {
+        std::fprintf(stderr, "Unable to write %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}